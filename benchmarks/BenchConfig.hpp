@@ -0,0 +1,6 @@
+#pragma once
+
+#include <cstdint>
+
+// Every benchmark draws from fixed seeds so two builds run the same work.
+inline constexpr std::uint64_t kBenchSeed = 0x5EED'CAFE'F00D'0001ULL;
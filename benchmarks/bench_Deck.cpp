@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchConfig.hpp"
+
+#include "Config.hpp"
+#include "core/Deck.hpp"
+#include "utils/random/EngineRandomProvider.hpp"
+
+namespace {
+
+void BM_DeckShuffle(benchmark::State& state) {
+    XoshiroRandomProvider rng(kBenchSeed);
+    Deck deck(kCardDeck, rng, static_cast<EDeckMode>(state.range(0)));
+    for (auto _ : state) {
+        deck.Shuffle();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Shuffle, then deal what a hand at range(1) players needs: two hole cards
+// each plus the board.
+void BM_DeckShuffleAndDeal(benchmark::State& state) {
+    XoshiroRandomProvider rng(kBenchSeed);
+    Deck deck(kCardDeck, rng, static_cast<EDeckMode>(state.range(0)));
+    const auto draws = static_cast<std::size_t>(state.range(1)) * 2 + 5;
+    for (auto _ : state) {
+        deck.Shuffle();
+        for (std::size_t i = 0; i < draws; ++i) {
+            benchmark::DoNotOptimize(deck.Draw());
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+constexpr auto kShuffleAll = static_cast<long>(EDeckMode::SHUFFLE_ALL);
+constexpr auto kDealOnDemand = static_cast<long>(EDeckMode::DEAL_ON_DEMAND);
+
+} // namespace
+
+BENCHMARK(BM_DeckShuffle)->ArgName("mode")->Arg(kShuffleAll)->Arg(kDealOnDemand);
+BENCHMARK(BM_DeckShuffleAndDeal)
+    ->ArgNames({"mode", "players"})
+    ->ArgsProduct({{kShuffleAll, kDealOnDemand}, {2, 6, 10}});
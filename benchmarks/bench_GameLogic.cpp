@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchConfig.hpp"
+
+#include "Config.hpp"
+#include "sim/HandSimulator.hpp"
+#include "table/PlayerList.hpp"
+#include "table/Table.hpp"
+#include "utils/AllocationCounter.hpp"
+#include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// The side-pot rebuild GameLogic::ComputePotsAmount runs after an all-in:
+// range(0) seats with distinct totals, so every level makes a pot.
+void BM_ComputePotsAmount(benchmark::State& state) {
+    const auto players = static_cast<std::size_t>(state.range(0));
+    PlayerList::CoinColumn_t contributions{};
+    for (std::size_t i = 0; i < players; ++i) {
+        contributions[i] = static_cast<Coins_t>(100 * (players - i));
+    }
+    const auto contenders = SeatMask::FirstN(players);
+
+    Table table(kBlindSmall, kBlindBig);
+    for (auto _ : state) {
+        table.BuildPots(contributions, contenders);
+        benchmark::DoNotOptimize(table.GetPots().size());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Whole hands, StartHand through FinishHand, at range(0) players. Calling
+// agents reach showdown every hand; random agents mix folds and all-ins.
+// allocs_per_hand should stay 0 (see test_AllocationCounter).
+template <EAgentKind kAgent>
+void BM_FullHand(benchmark::State& state) {
+    const ScopedLogLevel quiet(LogLevel::WARNING);
+    HandSimulator simulator({.players = static_cast<std::size_t>(state.range(0)),
+                             .seed = kBenchSeed,
+                             .agent = kAgent});
+    SimulationStats stats;
+    const AllocationScope allocations;
+    for (auto _ : state) {
+        simulator.PlayHand(stats);
+    }
+    const auto allocated = allocations.Elapsed();
+    state.SetItemsProcessed(static_cast<std::int64_t>(stats.hands));
+    state.counters["actions_per_hand"] =
+        static_cast<double>(stats.actions) / static_cast<double>(std::max<std::uint64_t>(stats.hands, 1));
+    state.counters["allocs_per_hand"] =
+        static_cast<double>(allocated.allocations) / static_cast<double>(std::max<std::uint64_t>(stats.hands, 1));
+}
+
+// BM_FullHand<RANDOM> with trace spans recording; compare the two to get
+// the tracing overhead (identical to it unless built with POKER_ENABLE_TRACING).
+void BM_FullHandTraced(benchmark::State& state) {
+    const ScopedLogLevel quiet(LogLevel::WARNING);
+    HandSimulator simulator({.players = static_cast<std::size_t>(state.range(0)),
+                             .seed = kBenchSeed,
+                             .agent = EAgentKind::RANDOM});
+    Tracer::Clear();
+    Tracer::SetEnabled(true);
+    SimulationStats stats;
+    for (auto _ : state) {
+        simulator.PlayHand(stats);
+        if (Tracer::ThisThreadBuffer().GetSize() > TraceBuffer::kCapacity / 2) {
+            state.PauseTiming();
+            Tracer::Clear();
+            state.ResumeTiming();
+        }
+    }
+    Tracer::SetEnabled(false);
+    Tracer::Clear();
+    state.SetItemsProcessed(static_cast<std::int64_t>(stats.hands));
+}
+
+} // namespace
+
+BENCHMARK(BM_ComputePotsAmount)->ArgName("players")->Arg(2)->Arg(6)->Arg(10);
+BENCHMARK(BM_FullHand<EAgentKind::CALLING>)->ArgName("players")->Arg(2)->Arg(6)->Arg(10);
+BENCHMARK(BM_FullHand<EAgentKind::RANDOM>)->ArgName("players")->Arg(2)->Arg(6)->Arg(10);
+BENCHMARK(BM_FullHandTraced)->ArgName("players")->Arg(2)->Arg(6)->Arg(10);
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include "core/Player.hpp"
+#include "table/PlayerList.hpp"
+
+#include <string>
+
+namespace {
+
+// range(0) players seated from seat 0; every third one has folded and
+// every fourth one is all-in.
+PlayerList MakeTable(std::size_t players) {
+    PlayerList list;
+    for (std::size_t i = 0; i < players; ++i) {
+        list.SitPlayer(Player("P" + std::to_string(i), 1000));
+        list.GetSession(i).SetLastBet(static_cast<Coins_t>(10 * (i + 1)));
+    }
+    for (std::size_t i = 2; i < players; i += 3) list.SetFold(i, true);
+    for (std::size_t i = 3; i < players; i += 4) list.SetAllIn(i, true);
+    return list;
+}
+
+void BM_PlayerListNextActiveSeat(benchmark::State& state) {
+    const auto list = MakeTable(static_cast<std::size_t>(state.range(0)));
+    std::size_t seat = 0;
+    for (auto _ : state) {
+        seat = *list.NextActiveSeat(seat);
+        benchmark::DoNotOptimize(seat);
+    }
+}
+
+// The seats a full raise puts back into GameLogic's to-act set.
+void BM_PlayerListSeatsThatCanBet(benchmark::State& state) {
+    const auto list = MakeTable(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(list.GetActiveMask() - list.GetAllInMask());
+    }
+}
+
+// The counts AdvanceTurn and the fold branch check after every action.
+void BM_PlayerListCountActiveAndAllIn(benchmark::State& state) {
+    const auto list = MakeTable(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(list.CountActiveSeats());
+        benchmark::DoNotOptimize(list.CountAllInPlayers());
+    }
+}
+
+void BM_PlayerListIterateActiveSeats(benchmark::State& state) {
+    const auto list = MakeTable(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        Coins_t total = 0;
+        for (const auto seat : list.GetActiveSeatIndices()) {
+            total += list.GetPlayer(seat).GetStack();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_PlayerListNextActiveSeat)->ArgName("players")->Arg(2)->Arg(6)->Arg(10);
+BENCHMARK(BM_PlayerListSeatsThatCanBet)->ArgName("players")->Arg(2)->Arg(6)->Arg(10);
+BENCHMARK(BM_PlayerListCountActiveAndAllIn)->ArgName("players")->Arg(2)->Arg(6)->Arg(10);
+BENCHMARK(BM_PlayerListIterateActiveSeats)->ArgName("players")->Arg(2)->Arg(6)->Arg(10);
@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+
+#include "BenchConfig.hpp"
+
+#include "Config.hpp"
+#include "core/Card.hpp"
+#include "table/PlayerSession.hpp"
+#include "utils/Translator.hpp"
+#include "utils/random/EngineRandomProvider.hpp"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace {
+
+struct Deal {
+    PlayerSession::Hand_t hand;
+    std::array<Card, 5> board;
+};
+
+// Random hands and boards drawn up front, so only the evaluation is timed.
+std::vector<Deal> MakeDeals(std::size_t count) {
+    XoshiroRandomProvider rng(kBenchSeed);
+    std::array<Card, Card::kCount> cards = kCardDeck;
+    std::vector<Deal> deals(count);
+    for (auto& deal : deals) {
+        rng.Shuffle(cards);
+        deal.hand = {cards[0], cards[1]};
+        std::copy_n(cards.begin() + 2, deal.board.size(), deal.board.begin());
+    }
+    return deals;
+}
+
+void BM_RankFromPlayerTableCards(benchmark::State& state) {
+    const auto board_size = static_cast<std::size_t>(state.range(0));
+    const auto deals = MakeDeals(4096);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto& deal = deals[i++ & (deals.size() - 1)];
+        benchmark::DoNotOptimize(Translator::RankFromPlayerTableCards(
+            deal.hand, std::span<const Card>(deal.board.data(), board_size)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_RankFromPlayerTableCards)->ArgName("board")->Arg(3)->Arg(4)->Arg(5);
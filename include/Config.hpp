@@ -3,26 +3,12 @@
 #include "core/Types.hpp"
 #include "core/Card.hpp"
 
-#include <raylib.h>
-
 #include <array>
-#include <vector>
-
-static constexpr int kTargetFPS = 60;
-static constexpr int kScreenWidth = 600;
-static constexpr int kScreenHeight = 600;
-
-namespace PlayerAttribs {
-static constexpr Vector2 kDimensions {20.f, 20.f};
-static constexpr float kSpeed = 10.f;
-static constexpr Color kColor = GREEN;
-}
 
-static constexpr Coins_t kBlindSmall = 2.0;
+static constexpr Coins_t kBlindSmall = 2;
 static constexpr Coins_t kBlindBig = kBlindSmall * 2;
 
-// TODO: Just to make it easier now to copy. Change to array later.
-static const std::vector<Card> kCardDeck {{
+static constexpr std::array<Card, Card::kCount> kCardDeck {{
     // CLUBS
     {ECardSuit::CLUBS, ECardRank::TWO},
     {ECardSuit::CLUBS, ECardRank::THREE},
@@ -3,6 +3,7 @@
 #include <raylib.h>
 
 #include "Config.hpp"
+#include "GraphicsConfig.hpp"
 
 #include <string>
 
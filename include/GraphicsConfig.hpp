@@ -0,0 +1,16 @@
+#pragma once
+
+#include <raylib.h>
+
+// Front-end only settings. Kept apart from Config.hpp so the engine
+// (pokerlib_core) never depends on raylib.
+
+static constexpr int kTargetFPS = 60;
+static constexpr int kScreenWidth = 600;
+static constexpr int kScreenHeight = 600;
+
+namespace PlayerAttribs {
+static constexpr Vector2 kDimensions {20.f, 20.f};
+static constexpr float kSpeed = 10.f;
+static constexpr Color kColor = GREEN;
+}
@@ -2,21 +2,56 @@
 
 #include "core/Types.hpp"
 
+#include <array>
+#include <cstdint>
 #include <string>
 
+// A card packed into a single byte: (rank - 2) * 4 + suit, with suits ordered
+// Clubs, Diamonds, Hearts, Spades. This is the same id phevaluator uses.
+
 class Card {
 public:
-    Card() noexcept;
+    using Id_t = std::uint8_t;
+    static constexpr std::size_t kCount = 52;
+
+    constexpr Card() noexcept 
+        : Card(ECardSuit::SPADES, ECardRank::ACE) {}
+
+    constexpr Card(ECardSuit suit, ECardRank rank) noexcept
+        : id_(static_cast<Id_t>(
+            (static_cast<int>(rank) - static_cast<int>(ECardRank::TWO)) * 4 + kSuitToIndex[static_cast<int>(suit)])) {}
+
+    [[nodiscard]] static constexpr Card FromId(Id_t id) noexcept {
+        return Card(id);
+    }
+
+    [[nodiscard]] constexpr Id_t GetId() const noexcept {
+        return id_;
+    }
 
-    Card(ECardSuit suit, ECardRank rank) noexcept;
-    ECardSuit GetSuit() const noexcept;
-    ECardRank GetRank() const noexcept;
+    [[nodiscard]] constexpr ECardSuit GetSuit() const noexcept {
+        return kIndexToSuit[id_ % 4];
+    }
 
-    bool operator==(const Card& other) const noexcept;
+    [[nodiscard]] constexpr ECardRank GetRank() const noexcept {
+        return static_cast<ECardRank>(id_ / 4 + static_cast<int>(ECardRank::TWO));
+    }
+
+    constexpr bool operator==(const Card& other) const noexcept = default;
 
     std::string ToString() const noexcept;
 
 private:
-    ECardSuit suit_;
-    ECardRank rank_;
+    // Indexed by ECardSuit (HEARTS, DIAMONDS, CLUBS, SPADES).
+    static constexpr std::array<Id_t, 4> kSuitToIndex {2, 1, 0, 3};
+    static constexpr std::array<ECardSuit, 4> kIndexToSuit {
+        ECardSuit::CLUBS, ECardSuit::DIAMONDS, ECardSuit::HEARTS, ECardSuit::SPADES
+    };
+
+    constexpr explicit Card(Id_t id) noexcept 
+        : id_(id) {}
+
+    Id_t id_;
 };
+
+static_assert(sizeof(Card) == 1);
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "core/Card.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+
+// Set of cards stored as a 64-bit mask: bit i is set when the card with
+// id i is in the set. Union, intersection, membership and size are single
+// bitwise operations.
+
+class CardSet {
+public:
+    using Mask_t = std::uint64_t;
+    static constexpr Mask_t kFullMask = (Mask_t{1} << Card::kCount) - 1;
+
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Card;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Card;
+
+        constexpr Iterator() noexcept = default;
+        constexpr explicit Iterator(Mask_t mask) noexcept : mask_(mask) {}
+
+        constexpr Card operator*() const noexcept {
+            return Card::FromId(static_cast<Card::Id_t>(std::countr_zero(mask_)));
+        }
+
+        constexpr Iterator& operator++() noexcept {
+            mask_ &= mask_ - 1;
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) noexcept {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        constexpr bool operator==(const Iterator& other) const noexcept = default;
+
+    private:
+        Mask_t mask_{0};
+    };
+
+    constexpr CardSet() noexcept = default;
+    constexpr explicit CardSet(Mask_t mask) noexcept : mask_(mask & kFullMask) {}
+
+    constexpr CardSet(std::initializer_list<Card> cards) noexcept {
+        for (const auto card : cards) Insert(card);
+    }
+
+    [[nodiscard]] static constexpr CardSet FromCards(std::span<const Card> cards) noexcept {
+        CardSet set;
+        for (const auto card : cards) set.Insert(card);
+        return set;
+    }
+
+    [[nodiscard]] static constexpr CardSet Full() noexcept {
+        return CardSet(kFullMask);
+    }
+
+    [[nodiscard]] static constexpr Mask_t Bit(Card card) noexcept {
+        return Mask_t{1} << card.GetId();
+    }
+
+    constexpr void Insert(Card card) noexcept { mask_ |= Bit(card); }
+    constexpr void Erase(Card card) noexcept { mask_ &= ~Bit(card); }
+    constexpr void Clear() noexcept { mask_ = 0; }
+
+    [[nodiscard]] constexpr bool Contains(Card card) const noexcept { return (mask_ & Bit(card)) != 0; }
+    [[nodiscard]] constexpr bool Intersects(CardSet other) const noexcept { return (mask_ & other.mask_) != 0; }
+    [[nodiscard]] constexpr std::size_t Count() const noexcept { return static_cast<std::size_t>(std::popcount(mask_)); }
+    [[nodiscard]] constexpr bool Empty() const noexcept { return mask_ == 0; }
+    [[nodiscard]] constexpr Mask_t GetMask() const noexcept { return mask_; }
+
+    // Cards of the full deck that are not in this set.
+    [[nodiscard]] constexpr CardSet Complement() const noexcept { return CardSet(~mask_); }
+
+    constexpr CardSet& operator|=(CardSet other) noexcept { mask_ |= other.mask_; return *this; }
+    constexpr CardSet& operator&=(CardSet other) noexcept { mask_ &= other.mask_; return *this; }
+    constexpr CardSet& operator-=(CardSet other) noexcept { mask_ &= ~other.mask_; return *this; }
+
+    friend constexpr CardSet operator|(CardSet lhs, CardSet rhs) noexcept { return lhs |= rhs; }
+    friend constexpr CardSet operator&(CardSet lhs, CardSet rhs) noexcept { return lhs &= rhs; }
+    friend constexpr CardSet operator-(CardSet lhs, CardSet rhs) noexcept { return lhs -= rhs; }
+
+    constexpr bool operator==(const CardSet& other) const noexcept = default;
+
+    constexpr Iterator begin() const noexcept { return Iterator(mask_); }
+    constexpr Iterator end() const noexcept { return Iterator(0); }
+
+private:
+    Mask_t mask_{0};
+};
+
+static_assert(sizeof(CardSet) == sizeof(std::uint64_t));
@@ -4,20 +4,42 @@
 
 #include "utils/random/StdRandomProvider.hpp"
 
-#include <vector>
+#include <array>
 #include <optional>
+#include <span>
 
-class Deck : public IDeck {
+#include <utility>
+
+class Deck final : public IDeck {
 public:
-    using DeckCards_t = std::vector<Card>;
-    Deck(DeckCards_t cards, IRandomProvider& rng) noexcept;
+    Deck(std::span<const Card> cards, IRandomProvider& rng, EDeckMode mode = EDeckMode::SHUFFLE_ALL) noexcept;
 
     void Shuffle() noexcept override;
     [[nodiscard]] std::optional<Card> Draw() noexcept override;
-    [[nodiscard]] const DeckCards_t& GetCards() const noexcept override;
+    [[nodiscard]] DeckCards_t GetCards() const noexcept override;
+
+    [[nodiscard]] DeckState SaveState() const noexcept override;
+    [[nodiscard]] bool RestoreState(const DeckState& state) noexcept override;
+
+    [[nodiscard]] EDeckMode GetMode() const noexcept;
 
 private:
-    DeckCards_t cards_;
+    std::array<Card, kMaxCards> cards_;
+    std::size_t cards_count_;
     IRandomProvider& rng_;
     std::size_t next_card_index_;
-};
\ No newline at end of file
+    EDeckMode mode_;
+};
+
+// Inline so DirectGameLogic draws without a call.
+inline std::optional<Card> Deck::Draw() noexcept {
+    if (next_card_index_ >= cards_count_) return std::nullopt;
+
+    if (mode_ == EDeckMode::DEAL_ON_DEMAND) {
+        // Pick uniformly among the cards not dealt yet. Whatever order they
+        // were left in, every undealt card is equally likely.
+        const auto pick = next_card_index_ + rng_.UniformIndex(cards_count_ - next_card_index_);
+        std::swap(cards_[next_card_index_], cards_[pick]);
+    }
+    return cards_[next_card_index_++];
+}
@@ -2,15 +2,49 @@
 
 #include "core/Card.hpp"
 
-#include <vector>
+#include "utils/random/IRandomProvider.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
 #include <optional>
 
+enum class EDeckMode {
+    SHUFFLE_ALL,    // Shuffle permutes every card up front.
+    DEAL_ON_DEMAND  // Shuffle is O(1); each Draw does one Fisher-Yates step.
+};
+
+// Plain-value copy of a deck's order and draw position (see GameState).
+// A deal-on-demand deck picks each card as it is drawn, so its snapshot
+// also holds the random provider's state; restoring it rewinds the
+// provider too. Providers that cannot export their state (std::mt19937)
+// only support snapshots of SHUFFLE_ALL decks.
+struct DeckState {
+    std::array<Card, Card::kCount> cards{};
+    std::uint8_t cards_count{0};
+    std::uint8_t next_card_index{0};
+    EDeckMode mode{EDeckMode::SHUFFLE_ALL};
+    bool has_rng_state{false};
+    RandomState rng_state{};
+
+    // False for a deal-on-demand snapshot taken without the provider state:
+    // its next draws would not match the run it was taken from.
+    [[nodiscard]] constexpr bool CanRestore() const noexcept {
+        return mode == EDeckMode::SHUFFLE_ALL || has_rng_state;
+    }
+};
+
 class IDeck {
 public:
-    using DeckCards_t = std::vector<Card>;
+    static constexpr std::size_t kMaxCards = Card::kCount;
+    using DeckCards_t = std::span<const Card>;
     virtual ~IDeck() = default;
 
     virtual void Shuffle() noexcept = 0;
     [[nodiscard]] virtual std::optional<Card> Draw() noexcept = 0;
-    [[nodiscard]] virtual const DeckCards_t& GetCards() const noexcept = 0;
+    [[nodiscard]] virtual DeckCards_t GetCards() const noexcept = 0;
+
+    [[nodiscard]] virtual DeckState SaveState() const noexcept = 0;
+    // Returns false, leaving the deck as it was, when !state.CanRestore().
+    [[nodiscard]] virtual bool RestoreState(const DeckState& state) noexcept = 0;
 };
@@ -16,5 +16,5 @@ public:
 
 private:
     std::string name_;
-    Coins_t stack_{0.0};
+    Coins_t stack_{0};
 };
@@ -1,7 +1,10 @@
 #pragma once
 
-// We may change it later.
-using Coins_t = double;
+#include <cstdint>
+
+// Chip amounts in minor units (the smallest chip). Integer, so stacks and
+// pots add up exactly and all-in / side-pot checks compare exactly.
+using Coins_t = std::int64_t;
 
 enum class EPlayerAction {
     FOLD,
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "core/Card.hpp"
+#include "core/CardSet.hpp"
+
+#include "table/ITable.hpp"
+#include "table/PlayerList.hpp"
+#include "table/PlayerSession.hpp"
+
+#include "utils/StaticVector.hpp"
+#include "utils/ThreadPool.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+// All-in equity engine. It only needs hands and a board, so it runs without
+// a GameLogic; EquityInput::FromTable fills the input from a live table.
+
+enum class EEquityMode {
+    AUTO,
+    MONTE_CARLO,
+    EXHAUSTIVE
+};
+
+struct EquityPlayer {
+    std::size_t seat;
+    PlayerSession::Hand_t hand;
+};
+
+struct EquityInput {
+    static constexpr std::size_t kMinPlayers = 2;
+    static constexpr std::size_t kMaxPlayers = PlayerList::kMaxPlayers;
+    using Players_t = StaticVector<EquityPlayer, kMaxPlayers>;
+
+    Players_t players;
+    ITable::CommunityCards_t board;
+    CardSet dead_cards;
+
+    // Every active (not folded) seat with its hole cards, plus the current board.
+    [[nodiscard]] static EquityInput FromTable(const PlayerList& player_list, const ITable& table);
+};
+
+struct SeatEquity {
+    std::size_t seat{0};
+    std::uint64_t wins{0};
+    // ties[k] counts run-outs where the pot was split between k players.
+    std::array<std::uint64_t, EquityInput::kMaxPlayers + 1> ties{};
+
+    [[nodiscard]] std::uint64_t GetTies() const noexcept;
+    // Pot share won on average: wins count 1, a k-way split counts 1/k.
+    [[nodiscard]] double GetEquity(std::uint64_t trials) const noexcept;
+};
+
+struct EquityResult {
+    std::uint64_t trials{0};
+    StaticVector<SeatEquity, EquityInput::kMaxPlayers> seats;
+
+    [[nodiscard]] double GetEquity(std::size_t player_index) const noexcept;
+};
+
+class EquityCalculator {
+public:
+    // Run-outs are split into chunks of this size, each with its own RNG stream
+    // derived from (seed, chunk index). Results depend on the seed only, not
+    // on the number of threads or on scheduling.
+    static constexpr std::uint64_t kChunkSize = 1 << 14;
+
+    explicit EquityCalculator(std::size_t thread_count = std::thread::hardware_concurrency());
+
+    // Below this many boards an exhaustive run stays on the calling thread.
+    static constexpr std::uint64_t kInlineEnumerationLimit = 4096;
+
+    // AUTO enumerates when that is exact and cheap (see PrefersExhaustive) and
+    // samples otherwise. trials and seed only matter when sampling.
+    [[nodiscard]] EquityResult Run(
+        const EquityInput& input, std::uint64_t trials, std::uint64_t seed, EEquityMode mode = EEquityMode::AUTO);
+
+    [[nodiscard]] EquityResult RunMonteCarlo(const EquityInput& input, std::uint64_t trials, std::uint64_t seed);
+
+    // Same sampling on the calling thread, for callers that already run many
+    // calculations in parallel. Gives the same result as RunMonteCarlo.
+    [[nodiscard]] static EquityResult RunMonteCarloInline(
+        const EquityInput& input, std::uint64_t trials, std::uint64_t seed);
+
+    // Walks every possible completion of the board once, in deck order.
+    [[nodiscard]] EquityResult RunExhaustive(const EquityInput& input);
+
+    // Turn and river spots, or a flop with at most three players.
+    [[nodiscard]] static bool PrefersExhaustive(const EquityInput& input) noexcept;
+
+    std::size_t GetThreadCount() const noexcept;
+
+private:
+    ThreadPool pool_;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "core/Card.hpp"
+
+#include "table/PlayerSession.hpp"
+
+#include "utils/StaticVector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+// Heads-up preflop equities for the 169 starting-hand classes.
+//
+// Hand classes live on a 13x13 grid indexed by rank (2 = 0 ... A = 12):
+// pairs on the diagonal, suited hands at [high][low], offsuit at [low][high].
+//
+// File layout (little endian): 16-byte header {magic "PFEQ", version,
+// class count, reserved} followed by 169 * 169 uint16 equities of the row
+// class against the column class, scaled to [0, 65535].
+
+class PreflopEquityTable {
+public:
+    static constexpr std::size_t kRanks = 13;
+    static constexpr std::size_t kHandClasses = kRanks * kRanks;
+    static constexpr std::size_t kMaxCombosPerClass = 12;
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::array<char, 4> kMagic {'P', 'F', 'E', 'Q'};
+
+    using Combos_t = StaticVector<PlayerSession::Hand_t, kMaxCombosPerClass>;
+
+    PreflopEquityTable() noexcept = default;
+    ~PreflopEquityTable();
+
+    PreflopEquityTable(PreflopEquityTable&& other) noexcept;
+    PreflopEquityTable& operator=(PreflopEquityTable&& other) noexcept;
+    PreflopEquityTable(const PreflopEquityTable&) = delete;
+    PreflopEquityTable& operator=(const PreflopEquityTable&) = delete;
+
+    // Maps the file into memory. Throws std::runtime_error if it cannot be
+    // opened or is not a valid table.
+    [[nodiscard]] static PreflopEquityTable Load(const std::string& path);
+
+    // equities holds kHandClasses * kHandClasses values in row-major order.
+    static void Write(const std::string& path, std::span<const double> equities);
+
+    [[nodiscard]] static std::size_t GetHandClass(const PlayerSession::Hand_t& hand) noexcept;
+    [[nodiscard]] static Combos_t GetClassCombos(std::size_t hand_class) noexcept;
+
+    [[nodiscard]] bool IsLoaded() const noexcept;
+    [[nodiscard]] double GetClassEquity(std::size_t hero_class, std::size_t villain_class) const noexcept;
+    [[nodiscard]] double GetEquity(const PlayerSession::Hand_t& hero, const PlayerSession::Hand_t& villain) const noexcept;
+
+private:
+    const std::uint16_t* equities_{nullptr};
+    void* mapping_{nullptr};
+    std::size_t mapping_size_{0};
+
+    void Release() noexcept;
+};
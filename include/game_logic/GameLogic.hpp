@@ -4,67 +4,111 @@
 
 #include "core/Types.hpp"
 #include "core/IDeck.hpp"
-#include "core/Player.hpp"
+#include "core/Deck.hpp"
+
+#include "game_logic/GameState.hpp"
 
 #include "table/PlayerList.hpp"
-#include "table/PlayerSession.hpp"
 #include "table/ITable.hpp"
+#include "table/Table.hpp"
 
 #include "utils/random/IRandomProvider.hpp"
 
+#include <concepts>
 #include <optional>
-
-struct Seat {
-    std::optional<Player> player {std::nullopt};
-    PlayerSession session;
-};
+#include <span>
 
 struct Action {
     EPlayerAction action;
-    Coins_t amount {0.0};
+    Coins_t amount {0};
+};
+
+// What BasicGameLogic needs from its deck and table. IDeck / ITable satisfy
+// them through virtual calls; Deck / Table (both final) satisfy them directly.
+template <typename T>
+concept DeckType = requires(T& deck, const T& const_deck, const DeckState& state) {
+    deck.Shuffle();
+    { deck.Draw() } -> std::same_as<std::optional<Card>>;
+    { const_deck.SaveState() } -> std::same_as<DeckState>;
+    { deck.RestoreState(state) } -> std::same_as<bool>;
 };
 
-struct Winner {
-    std::size_t player_index;
-    phevaluator::Rank rank;
-    Coins_t pot_amount;
+template <typename T>
+concept TableType = requires(T& table, const T& const_table, Card card, std::size_t idx,
+                             Coins_t amount, std::span<const Coins_t> contributions,
+                             SeatMask seats, const TableState& state) {
+    { const_table.GetBlindSmall() } -> std::convertible_to<Coins_t>;
+    { const_table.GetBlindBig() } -> std::convertible_to<Coins_t>;
+    table.AddCommunityCard(card);
+    table.ClearCommunityCards();
+    { const_table.GetCommunityCards() } -> std::convertible_to<const ITable::CommunityCards_t&>;
+    table.ResetPots();
+    { const_table.GetPots() } -> std::convertible_to<const ITable::Pots_t&>;
+    table.ContributeToPot(idx, amount);
+    table.RemovePlayerFromCurrentPot(idx);
+    table.BuildPots(contributions, seats);
+    { const_table.SaveState() } -> std::same_as<TableState>;
+    table.RestoreState(state);
 };
 
-class GameLogic {
+// Hand state machine, parameterised on the deck and table it drives so the
+// production build calls Deck / Table directly. Member definitions live in
+// GameLogic.cpp, which instantiates the two aliases below.
+template <DeckType TDeck, TableType TTable>
+class BasicGameLogic {
 public:
     static const std::size_t kMaxPlayers = 10;
-    GameLogic(IDeck& deck, ITable& table, PlayerList& player_list);
+    BasicGameLogic(TDeck& deck, TTable& table, PlayerList& player_list);
 
     void StartHand();
     void ProcessPlayerAction(const Action& action);
     void AdvanceState();
-    bool IsBettingRoundComplete() const;
+    bool IsBettingRoundComplete() const noexcept;
 
     ELogicState GetState() const noexcept;
+    bool IsRoundFinished() const noexcept;
     std::size_t GetDealerIndex() const noexcept;
+    // StartHand moves the button to the next occupied seat after this one.
+    void SetDealerIndex(std::size_t seat_index);
     std::size_t GetCurrentPlayerIndex() const noexcept;
+    Coins_t GetHighestBet() const noexcept;
+    // Smallest bet this round that counts as a full raise. Going all-in
+    // for less is allowed but does not reopen the betting.
+    Coins_t GetMinRaise() const noexcept;
+    // False when the seat to act already acted and has only faced a short
+    // all-in since: it may call or fold, and a raise is rejected.
+    bool CanRaise() const noexcept;
+
+    // Captures / resumes deck, table, seats and betting state in one value.
+    [[nodiscard]] GameState SaveState() const;
+    void RestoreState(const GameState& state);
 
 private:
-    IDeck& deck_;
-    ITable& table_;
+    TDeck& deck_;
+    TTable& table_;
     PlayerList& player_list_;
 
     ELogicState state_ {ELogicState::NONE};
     bool round_finished_{false};
-    bool did_someone_bet_{false};
 
     std::size_t dealer_index_{0};
     std::size_t index_blind_small_{0};
     std::size_t index_blind_big_{0};
     std::size_t current_player_index_{0};
 
-    Coins_t highest_bet_{0.0};
-    Coins_t last_raise_{0.0};
-    
+    Coins_t highest_bet_{0};
+    Coins_t last_raise_{0}; // Size of the last full raise (or opening bet).
+    // Seats that still owe an action this round. Each action removes its
+    // seat; a raise puts back every other seat that can still bet.
+    SeatMask to_act_;
+    // Seats that acted before a short all-in and may not raise this round.
+    SeatMask raise_closed_;
+
     void PayToPot(std::size_t player_idx, Coins_t amount);
     void ComputePotsAmount();
 
     void AdvanceTurn();
+    void BeginBettingRound(std::size_t from);
     void DealFlop();
     void DealTurn();
     void DealRiver();
@@ -74,4 +118,13 @@ private:
     void ResetBets();
     void DrawCommunityCards(std::size_t quantity = 1);
     void ComputePlayersRank();
+    void PayPot(const Pot& pot);
 };
+
+// Virtual dispatch through the interfaces; tests drive it with MockDeck / MockTable.
+using GameLogic = BasicGameLogic<IDeck, ITable>;
+// Devirtualised: deck and table calls are direct and can be inlined.
+using DirectGameLogic = BasicGameLogic<Deck, Table>;
+
+extern template class BasicGameLogic<IDeck, ITable>;
+extern template class BasicGameLogic<Deck, Table>;
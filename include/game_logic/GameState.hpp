@@ -0,0 +1,37 @@
+#pragma once
+
+#include "core/IDeck.hpp"
+#include "core/Types.hpp"
+
+#include "table/ITable.hpp"
+#include "table/PlayerList.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+// Betting-round bookkeeping owned by GameLogic.
+struct GameLogicState {
+    ELogicState state{ELogicState::NONE};
+    bool round_finished{false};
+    std::uint8_t dealer_index{0};
+    std::uint8_t index_blind_small{0};
+    std::uint8_t index_blind_big{0};
+    std::uint8_t current_player_index{0};
+    Coins_t highest_bet{0};
+    Coins_t last_raise{0};
+    std::uint16_t to_act{0}; // SeatMask bits
+    std::uint16_t raise_closed{0}; // SeatMask bits
+};
+
+// Snapshot of a whole hand in progress: deck order, table, seats and
+// betting state. It is a plain value with no pointers or heap members, so
+// cloning a node for lookahead is a memcpy. Resume it with
+// GameLogic::RestoreState on a logic whose players sit in the same seats.
+struct GameState {
+    DeckState deck;
+    TableState table;
+    PlayerListState players;
+    GameLogicState logic;
+};
+
+static_assert(std::is_trivially_copyable_v<GameState>, "GameState must stay memcpy-able");
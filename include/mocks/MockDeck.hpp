@@ -11,5 +11,7 @@ class MockDeck : public IDeck {
 public:
     MOCK_METHOD(void, Shuffle, (), (noexcept, override));
     MOCK_METHOD(std::optional<Card>, Draw, (), (noexcept, override));
-    MOCK_METHOD(const IDeck::DeckCards_t&, GetCards, (), (const, noexcept, override));
+    MOCK_METHOD(IDeck::DeckCards_t, GetCards, (), (const, noexcept, override));
+    MOCK_METHOD(DeckState, SaveState, (), (const, noexcept, override));
+    MOCK_METHOD(bool, RestoreState, (const DeckState& state), (noexcept, override));
 };
@@ -20,7 +20,9 @@ public:
     MOCK_METHOD(Coins_t, GetPot, (), (const, noexcept, override));
 
     MOCK_METHOD(void, AddCommunityCard, (Card card), (noexcept, override));
+    MOCK_METHOD(void, ClearCommunityCards, (), (noexcept, override));
     MOCK_METHOD(const ITable::CommunityCards_t&, GetCommunityCards, (), (const, noexcept, override));
+    MOCK_METHOD(CardSet, GetCommunityCardSet, (), (const, noexcept, override));
 
     MOCK_METHOD(void, ResetPots, (), (override));
     MOCK_METHOD(const ITable::Pots_t&, GetPots, (), (const, noexcept));
@@ -31,4 +33,8 @@ public:
     MOCK_METHOD(void, AddPlayerToPot, (std::size_t player_idx, std::size_t pot_idx), (override));
     MOCK_METHOD(Pot&, AddPot, (Coins_t amount), (override));
     MOCK_METHOD(Pot&, GetPot, (std::size_t pot_idx), (override));
+    MOCK_METHOD(void, BuildPots, (std::span<const Coins_t> contributions, SeatMask contenders), (override));
+
+    MOCK_METHOD(TableState, SaveState, (), (const, override));
+    MOCK_METHOD(void, RestoreState, (const TableState& state), (override));
 };
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "sim/IAgent.hpp"
+
+#include "utils/random/Xoshiro256.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// Turns an intent into an Action GameLogic accepts from this seat: amounts
+// are the seat's total bet for the round and never exceed its stack, a free
+// fold becomes a check and a call with nothing to call becomes a check.
+[[nodiscard]] Action MakeLegalAction(EPlayerAction intent, const AgentView& view) noexcept;
+
+// Checks or calls every time.
+class CallingAgent : public IAgent {
+public:
+    [[nodiscard]] Action Decide(const AgentView& view) override;
+};
+
+// Picks fold / call / raise / all-in with fixed weights.
+class RandomAgent : public IAgent {
+public:
+    explicit RandomAgent(std::uint64_t seed);
+    [[nodiscard]] Action Decide(const AgentView& view) override;
+    void NewHand(std::uint64_t seed) override;
+
+private:
+    Xoshiro256StarStar rng_;
+};
+
+// Replays a fixed sequence of intents, wrapping around at the end and
+// starting over every hand.
+class ScriptedAgent : public IAgent {
+public:
+    explicit ScriptedAgent(std::vector<EPlayerAction> script);
+    [[nodiscard]] Action Decide(const AgentView& view) override;
+    void NewHand(std::uint64_t seed) override;
+
+private:
+    std::vector<EPlayerAction> script_;
+    std::size_t next_{0};
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Config.hpp"
+
+#include "core/Deck.hpp"
+
+#include "game_logic/GameLogic.hpp"
+
+#include "sim/IAgent.hpp"
+
+#include "table/PlayerList.hpp"
+#include "table/Table.hpp"
+
+#include "utils/AllocationCounter.hpp"
+#include "utils/random/EngineRandomProvider.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+enum class EAgentKind {
+    CALLING,
+    RANDOM,
+    SCRIPTED
+};
+
+struct SimulationConfig {
+    std::size_t players{6};
+    Coins_t starting_stack{kBlindBig * 100};
+    std::uint64_t seed{0};     // Master seed.
+    std::uint64_t table_id{0}; // Second level of the seed hierarchy.
+    EAgentKind agent{EAgentKind::RANDOM};
+    std::vector<EPlayerAction> script{}; // SCRIPTED only
+};
+
+struct SimulationStats {
+    std::uint64_t hands{0};
+    std::uint64_t actions{0};
+    std::uint64_t showdowns{0}; // Hands that reached showdown with 2+ players left.
+    // Heap use of the GameLogic calls, by the state each call left it in
+    // (StartHand counts under PREFLOP, FinishHand under HAND_FINISHED).
+    // All 0 unless the allocation hooks are linked in.
+    std::array<AllocationCount, static_cast<std::size_t>(ELogicState::HAND_FINISHED) + 1> allocations{};
+
+    void Merge(const SimulationStats& other) noexcept;
+};
+
+// Plays whole hands headlessly on one table: GameLogic drives the state and
+// every seat is an agent. Hand h depends only on (seed, table_id, h): stacks
+// are reset, the button sits on seat h % players, and the deck and agents
+// are reseeded from DeriveHandSeed. ReplayHand re-deals any hand on its own.
+class HandSimulator {
+public:
+    // A hand that takes more decisions than this is stuck; Run throws.
+    static constexpr std::size_t kMaxActionsPerHand = 1000;
+
+    // Throws std::invalid_argument for a config the constructor would reject.
+    static void Validate(const SimulationConfig& config);
+
+    explicit HandSimulator(const SimulationConfig& config);
+
+    HandSimulator(const HandSimulator&) = delete;
+    HandSimulator& operator=(const HandSimulator&) = delete;
+
+    [[nodiscard]] SimulationStats Run(std::uint64_t hands);
+    // Plays the next hand number.
+    void PlayHand(SimulationStats& stats);
+    // Plays hand number `hand` in isolation; the next-hand counter is untouched.
+    void ReplayHand(std::uint64_t hand, SimulationStats& stats);
+
+    [[nodiscard]] std::uint64_t GetNextHand() const noexcept;
+    [[nodiscard]] const PlayerList& GetPlayerList() const noexcept;
+    [[nodiscard]] const Table& GetTable() const noexcept;
+    [[nodiscard]] const DirectGameLogic& GetGameLogic() const noexcept;
+
+private:
+    SimulationConfig config_;
+    XoshiroRandomProvider rng_;
+    Deck deck_;
+    DeckState fresh_deck_;
+    Table table_;
+    PlayerList player_list_;
+    DirectGameLogic logic_;
+    std::vector<std::unique_ptr<IAgent>> agents_; // Indexed by seat.
+    std::uint64_t next_hand_{0};
+
+    void PlayHandNumber(std::uint64_t hand, SimulationStats& stats);
+    // Runs one GameLogic call and books its allocations.
+    template <typename F>
+    void Measure(SimulationStats& stats, F&& call);
+
+    [[nodiscard]] AgentView MakeView(std::size_t seat) const;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "core/Types.hpp"
+
+#include "game_logic/GameLogic.hpp"
+
+#include "table/PlayerSession.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+// What a seat can see when it is asked to act.
+struct AgentView {
+    std::size_t seat;
+    ELogicState state;
+    PlayerSession::Hand_t hand;
+    Coins_t stack;
+    Coins_t last_bet;
+    Coins_t highest_bet;
+    Coins_t big_blind;
+    Coins_t min_raise{0};
+    bool can_raise{true};
+
+    Coins_t GetToCall() const noexcept {
+        return std::max<Coins_t>(highest_bet - last_bet, 0);
+    }
+};
+
+class IAgent {
+public:
+    virtual ~IAgent() = default;
+    [[nodiscard]] virtual Action Decide(const AgentView& view) = 0;
+    // Called before every hand with a seed derived from the hand's seed, so
+    // a replayed hand makes the same decisions.
+    virtual void NewHand(std::uint64_t /*seed*/) {}
+};
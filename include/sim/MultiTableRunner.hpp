@@ -0,0 +1,30 @@
+#pragma once
+
+#include "sim/HandSimulator.hpp"
+
+#include "utils/ThreadPool.hpp"
+
+#include <cstdint>
+#include <thread>
+
+// Shards independent tables across a work-stealing ThreadPool. Each table
+// is its own HandSimulator (deck, table, players, logic, RNG stream) built
+// and played inside one task, so nothing is shared while hands run. Stats go
+// to a per-worker slot and are merged once the pool is idle.
+class MultiTableRunner {
+public:
+    explicit MultiTableRunner(std::size_t thread_count = std::thread::hardware_concurrency());
+
+    // Plays `hands_per_table` hands on each of `tables` tables. Table i runs
+    // with table_id i under the master seed table_config.seed, so results do
+    // not depend on the number of threads and any hand can be replayed with
+    // HandSimulator::ReplayHand.
+    [[nodiscard]] SimulationStats Run(const SimulationConfig& table_config,
+                                      std::size_t tables,
+                                      std::uint64_t hands_per_table);
+
+    [[nodiscard]] std::size_t GetThreadCount() const noexcept;
+
+private:
+    ThreadPool pool_;
+};
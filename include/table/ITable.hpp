@@ -2,21 +2,44 @@
 
 #include "core/Types.hpp"
 #include "core/Card.hpp"
+#include "core/CardSet.hpp"
 
-#include <unordered_set>
+#include "table/SeatMask.hpp"
 
+#include "utils/StaticVector.hpp"
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+// Seats eligible to win a pot are a SeatMask: membership is a bit test and
+// iterating it yields seat indices, so a pot is 16 bytes and memcpy-able.
 class Pot {
 public:
+    Pot() = default;
     Pot(Coins_t amt) : amount(amt) {}
     
-    Coins_t amount{0.0};
-    std::unordered_set<std::size_t> players {};
+    Coins_t amount{0};
+    SeatMask players {};
+};
+
+static_assert(std::is_trivially_copyable_v<Pot> && sizeof(Pot) <= 16);
+
+// Pot with its players stored as a seat bitmask (bit i = seat i).
+struct PotState {
+    Coins_t amount{0};
+    std::uint16_t players{0};
 };
 
+struct TableState;
+
 class ITable {
 public:
-    using CommunityCards_t = std::vector<Card>;
-    using Pots_t = std::vector<Pot>;
+    static constexpr std::size_t kMaxCommunityCards = 5;
+    // Main pot plus one side pot per distinct all-in amount.
+    static constexpr std::size_t kMaxPots = 10;
+    using CommunityCards_t = StaticVector<Card, kMaxCommunityCards>;
+    using Pots_t = StaticVector<Pot, kMaxPots>;
 
     virtual ~ITable() = default;
 
@@ -30,7 +53,9 @@ public:
     [[nodiscard]] virtual Coins_t GetPot() const noexcept = 0;
 
     virtual void AddCommunityCard(Card card) noexcept = 0;
+    virtual void ClearCommunityCards() noexcept = 0;
     [[nodiscard]] virtual const CommunityCards_t& GetCommunityCards() const noexcept = 0;
+    [[nodiscard]] virtual CardSet GetCommunityCardSet() const noexcept = 0;
 
     virtual void ResetPots() = 0;
     [[nodiscard]] virtual const Pots_t& GetPots() const noexcept = 0;
@@ -41,4 +66,24 @@ public:
     virtual void AddPlayerToPot(std::size_t player_idx, std::size_t pot_idx) = 0;
     [[nodiscard]] virtual Pot& AddPot(Coins_t amount) = 0;
     [[nodiscard]] virtual Pot& GetPot(std::size_t pot_idx) = 0;
+    // Replaces the pots with the main and side pots for these per-seat
+    // contributions. Only `contenders` (seats still in the hand) can win a
+    // pot; chips from other seats are dead money in the pots they reach.
+    virtual void BuildPots(std::span<const Coins_t> contributions, SeatMask contenders) = 0;
+
+    [[nodiscard]] virtual TableState SaveState() const = 0;
+    virtual void RestoreState(const TableState& state) = 0;
+};
+
+// Plain-value copy of everything a table holds (see GameState).
+struct TableState {
+    static constexpr std::size_t kMaxPots = ITable::kMaxPots;
+
+    Coins_t blind_small{0};
+    Coins_t blind_big{0};
+    Coins_t pot{0};
+    ITable::CommunityCards_t community_cards;
+    CardSet community_set;
+    StaticVector<PotState, kMaxPots> pots;
+    std::uint8_t current_pot_idx{0};
 };
@@ -1,27 +1,139 @@
 #pragma once
 
+#include <phevaluator/phevaluator.h>
+
 #include <array>
+#include <cstdint>
 #include <optional>
-#include <vector>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
+#include "core/Card.hpp"
+#include "core/CardSet.hpp"
 #include "core/Player.hpp"
 #include "table/PlayerSession.hpp"
+#include "table/SeatMask.hpp"
+
+struct PlayerListState;
 
 // Note: Active Seat
 //       Seat has player; Player is not fold.
 //       Occupied Seat
 //       Seat has player;
+//
+// Seats are stored as a structure of arrays: stacks, last bets, hands and
+// ranks each live in their own contiguous array, and occupied / folded /
+// all-in are SeatMasks. Per-action scans over bets or stacks touch one
+// small array; names are kept apart since only the front-end reads them.
+// GetPlayer / GetSession return lightweight references into those arrays;
+// PlayerRef has the same API as Player.
 
 class PlayerList {
 public:
     static constexpr std::size_t kMaxPlayers = 10;
+    // Seat index lists are masks: iterating them never allocates.
+    using SeatIndices_t = SeatMask;
+    using CoinColumn_t = std::array<Coins_t, kMaxPlayers>;
+    using RankColumn_t = std::array<phevaluator::Rank, kMaxPlayers>;
 
-    struct Seat {
-        std::optional<Player> player;
-        PlayerSession session;
+    // Player view of one seat. TList is PlayerList or const PlayerList.
+    template <typename TList>
+    class BasicPlayerRef {
+    public:
+        BasicPlayerRef(TList& list, std::size_t seat_index) noexcept
+            : list_(&list), seat_(seat_index) {}
+
+        // Mutable ref -> const ref.
+        template <typename TOther>
+            requires (std::is_const_v<TList> && !std::is_const_v<TOther>)
+        BasicPlayerRef(const BasicPlayerRef<TOther>& other) noexcept
+            : list_(other.list_), seat_(other.seat_) {}
+
+        std::string_view GetName() const noexcept { return list_->names_[seat_]; }
+        Coins_t GetStack() const noexcept { return list_->stacks_[seat_]; }
+
+        void SetStack(Coins_t stack) const noexcept requires (!std::is_const_v<TList>) {
+            list_->stacks_[seat_] = stack;
+        }
+        void IncreaseStack(Coins_t amount) const noexcept requires (!std::is_const_v<TList>) {
+            list_->stacks_[seat_] += amount;
+        }
+        void DecreaseStack(Coins_t amount) const noexcept requires (!std::is_const_v<TList>) {
+            list_->stacks_[seat_] -= amount;
+        }
+
+    private:
+        template <typename> friend class BasicPlayerRef;
+        TList* list_;
+        std::size_t seat_;
+    };
+
+    // Per-hand state of one seat. Fold / all-in write the seat masks, so
+    // they cannot drift apart from the session.
+    template <typename TList>
+    class BasicSessionRef {
+    public:
+        using Hand_t = PlayerSession::Hand_t;
+
+        BasicSessionRef(TList& list, std::size_t seat_index) noexcept
+            : list_(&list), seat_(seat_index) {}
+
+        template <typename TOther>
+            requires (std::is_const_v<TList> && !std::is_const_v<TOther>)
+        BasicSessionRef(const BasicSessionRef<TOther>& other) noexcept
+            : list_(other.list_), seat_(other.seat_) {}
+
+        const Hand_t& GetHand() const noexcept { return list_->hands_[seat_]; }
+        CardSet GetHandSet() const noexcept { return list_->hand_sets_[seat_]; }
+        bool IsFold() const noexcept { return list_->folded_.Contains(seat_); }
+        bool IsAllIn() const noexcept { return list_->all_in_.Contains(seat_); }
+        Coins_t GetLastBet() const noexcept { return list_->last_bets_[seat_]; }
+        Coins_t GetTotalBet() const noexcept { return list_->total_bets_[seat_]; }
+        phevaluator::Rank GetRank() const noexcept { return list_->ranks_[seat_]; }
+
+        void NewHand() const noexcept requires (!std::is_const_v<TList>) {
+            list_->ResetSeatSession(seat_);
+        }
+        bool AddCard(const Card& card) const noexcept requires (!std::is_const_v<TList>) {
+            auto& count = list_->cards_counts_[seat_];
+            if (count == list_->hands_[seat_].size()) return false;
+
+            list_->hands_[seat_][count++] = card;
+            list_->hand_sets_[seat_].Insert(card);
+            return true;
+        }
+        void ClearHand() const noexcept requires (!std::is_const_v<TList>) {
+            list_->cards_counts_[seat_] = 0;
+            list_->hand_sets_[seat_].Clear();
+        }
+        void SetFold(bool fold) const noexcept requires (!std::is_const_v<TList>) {
+            list_->folded_.Set(seat_, fold);
+        }
+        void SetAllIn(bool all_in) const noexcept requires (!std::is_const_v<TList>) {
+            list_->all_in_.Set(seat_, all_in);
+        }
+        void SetLastBet(Coins_t bet) const noexcept requires (!std::is_const_v<TList>) {
+            list_->last_bets_[seat_] = bet;
+        }
+        void SetTotalBet(Coins_t bet) const noexcept requires (!std::is_const_v<TList>) {
+            list_->total_bets_[seat_] = bet;
+        }
+        void SetRank(phevaluator::Rank rank) const noexcept requires (!std::is_const_v<TList>) {
+            list_->ranks_[seat_] = rank;
+        }
+
+    private:
+        template <typename> friend class BasicSessionRef;
+        TList* list_;
+        std::size_t seat_;
     };
 
+    using PlayerRef = BasicPlayerRef<PlayerList>;
+    using ConstPlayerRef = BasicPlayerRef<const PlayerList>;
+    using SessionRef = BasicSessionRef<PlayerList>;
+    using ConstSessionRef = BasicSessionRef<const PlayerList>;
+
     PlayerList();
 
     void ClearPlayers();
@@ -29,7 +141,7 @@ public:
     std::optional<std::size_t> SitPlayer(Player&& player);
     bool SitPlayerAt(Player&& player, std::size_t seat_index);
     bool RemovePlayer(std::size_t seat_index);
-    
+
     std::optional<std::size_t> NextOccupiedSeat(std::size_t from) const;
     std::optional<std::size_t> NextActiveSeat(std::size_t from) const;
     std::optional<std::size_t> NextEmptySeat(std::size_t from) const;
@@ -37,30 +149,73 @@ public:
     std::optional<std::size_t> FindFirstActiveSeat() const;
 
     std::optional<std::size_t> FindEmptySeat() const;
-    std::vector<std::size_t> GetActiveSeatIndices() const;
+    SeatIndices_t GetActiveSeatIndices() const;
     std::size_t CountActiveSeats() const;
-    std::vector<std::size_t> GetOccupiedSeatIndices() const;
+    SeatIndices_t GetOccupiedSeatIndices() const;
     std::size_t CountOccupiedSeats() const;
     std::size_t CountAllInPlayers() const;
-    Coins_t GetMinLastBet() const;
 
-    Player& GetPlayer(std::size_t seat_index);
-    const Player& GetPlayer(std::size_t seat_index) const;
+    SeatMask GetOccupiedMask() const noexcept;
+    SeatMask GetActiveMask() const noexcept;
+    SeatMask GetFoldedMask() const noexcept;
+    SeatMask GetAllInMask() const noexcept;
 
-    PlayerSession& GetSession(std::size_t seat_index);
-    const PlayerSession& GetSession(std::size_t seat_index) const;
+    // Whole columns, indexed by seat. Empty seats hold 0.
+    const CoinColumn_t& GetStacks() const noexcept;
+    const CoinColumn_t& GetLastBets() const noexcept;
+    // Chips each seat has put in this hand; the input to the side-pot builder.
+    const CoinColumn_t& GetTotalBets() const noexcept;
+    // Showdown ranks, set by GameLogic for the seats contesting a pot.
+    const RankColumn_t& GetRanks() const noexcept;
 
-    Seat& GetSeat(std::size_t seat_index);
-    const Seat& GetSeat(std::size_t seat_index) const;
+    void SetFold(std::size_t seat_index, bool fold) noexcept;
+    void SetAllIn(std::size_t seat_index, bool all_in) noexcept;
+    // Clears hand, bet, fold and all-in for every seated player.
+    void NewHand() noexcept;
+    // Sets every last bet to 0, e.g. between betting rounds.
+    void ClearLastBets() noexcept;
 
-    // Iteratos for range
-    auto begin() { return seats_.begin(); }
-    auto end()   { return seats_.end();   }
-    auto begin() const { return seats_.begin(); }
-    auto end()   const { return seats_.end();   }
+    PlayerRef GetPlayer(std::size_t seat_index);
+    ConstPlayerRef GetPlayer(std::size_t seat_index) const;
+
+    SessionRef GetSession(std::size_t seat_index);
+    ConstSessionRef GetSession(std::size_t seat_index) const;
 
     void ResetSessions();
 
+    [[nodiscard]] PlayerListState SaveState() const noexcept;
+    // Throws std::invalid_argument if the state was saved with other seats occupied.
+    void RestoreState(const PlayerListState& state);
+
 private:
-    std::array<Seat, kMaxPlayers> seats_;
-};
\ No newline at end of file
+    // Hot: read or written on every action.
+    CoinColumn_t stacks_{};
+    CoinColumn_t last_bets_{};
+    CoinColumn_t total_bets_{};
+    SeatMask occupied_;
+    SeatMask folded_;
+    SeatMask all_in_;
+
+    // Warm: written when dealing, read at showdown.
+    std::array<PlayerSession::Hand_t, kMaxPlayers> hands_{};
+    std::array<CardSet, kMaxPlayers> hand_sets_{};
+    std::array<std::uint8_t, kMaxPlayers> cards_counts_{};
+    RankColumn_t ranks_{};
+
+    // Cold.
+    std::array<std::string, kMaxPlayers> names_{};
+
+    void ResetSeatSession(std::size_t seat_index) noexcept;
+};
+
+// Plain-value copy of the per-hand state of every seat (see GameState).
+// Player names are identity, not state, and are not part of it.
+struct PlayerListState {
+    struct SeatState {
+        bool occupied{false};
+        Coins_t stack{0};
+        PlayerSession session;
+    };
+
+    std::array<SeatState, PlayerList::kMaxPlayers> seats{};
+};
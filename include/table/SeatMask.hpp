@@ -0,0 +1,122 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+
+// Set of seat indices stored as a 16-bit mask: bit i is set when seat i is
+// in the set. Counting is a popcount and "next seat after x, wrapping" is a
+// count-trailing-zeros on the mask split at x.
+
+class SeatMask {
+public:
+    using Mask_t = std::uint16_t;
+    static constexpr std::size_t kMaxSeats = 16;
+
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::size_t;
+
+        constexpr Iterator() noexcept = default;
+        constexpr explicit Iterator(Mask_t mask) noexcept : mask_(mask) {}
+
+        constexpr std::size_t operator*() const noexcept {
+            return static_cast<std::size_t>(std::countr_zero(mask_));
+        }
+
+        constexpr Iterator& operator++() noexcept {
+            mask_ &= static_cast<Mask_t>(mask_ - 1);
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) noexcept {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        constexpr bool operator==(const Iterator& other) const noexcept = default;
+
+    private:
+        Mask_t mask_{0};
+    };
+
+    constexpr SeatMask() noexcept = default;
+    constexpr explicit SeatMask(Mask_t mask) noexcept : mask_(mask) {}
+
+    constexpr SeatMask(std::initializer_list<std::size_t> seats) noexcept {
+        for (const auto seat : seats) Insert(seat);
+    }
+
+    // Seats [0, count).
+    [[nodiscard]] static constexpr SeatMask FirstN(std::size_t count) noexcept {
+        assert(count <= kMaxSeats);
+        return SeatMask(static_cast<Mask_t>((std::uint32_t{1} << count) - 1));
+    }
+
+    [[nodiscard]] static constexpr Mask_t Bit(std::size_t seat) noexcept {
+        assert(seat < kMaxSeats);
+        return static_cast<Mask_t>(Mask_t{1} << seat);
+    }
+
+    constexpr void Insert(std::size_t seat) noexcept { mask_ |= Bit(seat); }
+    constexpr void Erase(std::size_t seat) noexcept { mask_ &= static_cast<Mask_t>(~Bit(seat)); }
+    constexpr void Set(std::size_t seat, bool value) noexcept { value ? Insert(seat) : Erase(seat); }
+    constexpr void Clear() noexcept { mask_ = 0; }
+
+    [[nodiscard]] constexpr bool Contains(std::size_t seat) const noexcept { return (mask_ & Bit(seat)) != 0; }
+    [[nodiscard]] constexpr std::size_t Count() const noexcept { return static_cast<std::size_t>(std::popcount(mask_)); }
+    [[nodiscard]] constexpr bool Empty() const noexcept { return mask_ == 0; }
+    [[nodiscard]] constexpr Mask_t GetMask() const noexcept { return mask_; }
+
+    [[nodiscard]] constexpr std::optional<std::size_t> First() const noexcept {
+        if (mask_ == 0) return std::nullopt;
+        return static_cast<std::size_t>(std::countr_zero(mask_));
+    }
+
+    [[nodiscard]] constexpr std::optional<std::size_t> Last() const noexcept {
+        if (mask_ == 0) return std::nullopt;
+        return static_cast<std::size_t>(std::bit_width(mask_) - 1);
+    }
+
+    // First seat after `from`, wrapping around; `from` itself comes last.
+    [[nodiscard]] constexpr std::optional<std::size_t> NextAfter(std::size_t from) const noexcept {
+        assert(from < kMaxSeats);
+        const auto above = static_cast<Mask_t>(mask_ & ~((std::uint32_t{2} << from) - 1));
+        if (above != 0) return static_cast<std::size_t>(std::countr_zero(above));
+        return First();
+    }
+
+    constexpr SeatMask& operator|=(SeatMask other) noexcept { mask_ |= other.mask_; return *this; }
+    constexpr SeatMask& operator&=(SeatMask other) noexcept { mask_ &= other.mask_; return *this; }
+    constexpr SeatMask& operator-=(SeatMask other) noexcept { mask_ &= static_cast<Mask_t>(~other.mask_); return *this; }
+
+    friend constexpr SeatMask operator|(SeatMask lhs, SeatMask rhs) noexcept { return lhs |= rhs; }
+    friend constexpr SeatMask operator&(SeatMask lhs, SeatMask rhs) noexcept { return lhs &= rhs; }
+    friend constexpr SeatMask operator-(SeatMask lhs, SeatMask rhs) noexcept { return lhs -= rhs; }
+
+    constexpr bool operator==(const SeatMask& other) const noexcept = default;
+
+    constexpr Iterator begin() const noexcept { return Iterator(mask_); }
+    constexpr Iterator end() const noexcept { return Iterator(0); }
+
+    // Container-style names, so a mask can stand in for a list of seat indices.
+    constexpr Iterator cbegin() const noexcept { return begin(); }
+    constexpr Iterator cend() const noexcept { return end(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return Count(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return Empty(); }
+
+private:
+    Mask_t mask_{0};
+};
+
+static_assert(sizeof(SeatMask) == sizeof(std::uint16_t));
+static_assert(std::forward_iterator<SeatMask::Iterator>);
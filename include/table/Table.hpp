@@ -7,9 +7,7 @@
 #include "core/Deck.hpp"
 #include "core/Card.hpp"
 
-// TODO: ALL-IN + Side pots
-
-class Table : public ITable {
+class Table final : public ITable {
 public:
     Table() noexcept = default;
     Table(Coins_t blind_small, Coins_t blind_big) noexcept;
@@ -24,7 +22,9 @@ public:
     [[nodiscard]] Coins_t GetPot() const noexcept override; // remove
 
      void AddCommunityCard(Card card) noexcept override;
+    void ClearCommunityCards() noexcept override;
     [[nodiscard]] const CommunityCards_t& GetCommunityCards() const noexcept override;
+    [[nodiscard]] CardSet GetCommunityCardSet() const noexcept override;
 
     void ResetPots() override;
     [[nodiscard]] const Pots_t& GetPots() const noexcept override;
@@ -35,12 +35,27 @@ public:
     void AddPlayerToPot(std::size_t player_idx, std::size_t pot_idx) override;
     [[nodiscard]] Pot& AddPot(Coins_t amount) override;
     [[nodiscard]] Pot& GetPot(std::size_t pot_idx) override;
+    void BuildPots(std::span<const Coins_t> contributions, SeatMask contenders) override;
+
+    [[nodiscard]] TableState SaveState() const override;
+    void RestoreState(const TableState& state) override;
 
 private:
-    Coins_t pot_{0.0}; // remove
-    Coins_t blind_big_{0.0};
-    Coins_t blind_small_{0.0};
+    Coins_t pot_{0}; // remove
+    Coins_t blind_big_{0};
+    Coins_t blind_small_{0};
     CommunityCards_t community_cards_;
+    CardSet community_set_;
     Pots_t pots_;
     std::size_t current_pot_idx_{0};
 };
+
+// Inline so DirectGameLogic pays into the pot without a call.
+inline void Table::ExtractFromPot(Coins_t amount) {
+    pots_[current_pot_idx_].amount -= amount;
+}
+
+inline void Table::ContributeToPot(std::size_t player_idx, Coins_t amount) {
+    pots_[current_pot_idx_].amount += amount;
+    pots_[current_pot_idx_].players.Insert(player_idx);
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Heap allocations made by the current thread. The counts only move when
+// the program links the replacement operator new / delete in
+// src/utils/AllocationHooks.cpp (the pokerlib_alloc_hooks object library);
+// runTests and poker_bench always do. Counters are thread-local, so work on
+// other threads (e.g. the log writer) does not show up in a measurement.
+
+struct AllocationCount {
+    std::uint64_t allocations{0};
+    std::uint64_t bytes{0};
+
+    AllocationCount& operator+=(const AllocationCount& other) noexcept {
+        allocations += other.allocations;
+        bytes += other.bytes;
+        return *this;
+    }
+
+    friend AllocationCount operator-(AllocationCount lhs, const AllocationCount& rhs) noexcept {
+        lhs.allocations -= rhs.allocations;
+        lhs.bytes -= rhs.bytes;
+        return lhs;
+    }
+
+    friend bool operator==(const AllocationCount&, const AllocationCount&) = default;
+};
+
+namespace AllocationCounter {
+
+namespace detail {
+inline thread_local AllocationCount this_thread;
+inline std::atomic<bool> hooks_installed{false};
+} // namespace detail
+
+// Called by the replacement operator new.
+inline void Record(std::size_t bytes) noexcept {
+    ++detail::this_thread.allocations;
+    detail::this_thread.bytes += bytes;
+}
+
+[[nodiscard]] inline AllocationCount ThisThread() noexcept {
+    return detail::this_thread;
+}
+
+// False when the hooks are not linked in and every count stays 0.
+[[nodiscard]] inline bool IsInstalled() noexcept {
+    return detail::hooks_installed.load(std::memory_order_relaxed);
+}
+
+} // namespace AllocationCounter
+
+// Allocations made by this thread since construction.
+class AllocationScope {
+public:
+    AllocationScope() noexcept
+        : start_(AllocationCounter::ThisThread()) {}
+
+    [[nodiscard]] AllocationCount Elapsed() const noexcept {
+        return AllocationCounter::ThisThread() - start_;
+    }
+
+private:
+    AllocationCount start_;
+};
@@ -47,4 +47,17 @@ namespace EnumString {
     }
 }
 
+[[nodiscard]] inline constexpr std::string_view ToString(ELogicState state) noexcept {
+    switch (state) {
+        case ELogicState::NONE:          return "None";
+        case ELogicState::PREFLOP:       return "Preflop";
+        case ELogicState::FLOP:          return "Flop";
+        case ELogicState::TURN:          return "Turn";
+        case ELogicState::RIVER:         return "River";
+        case ELogicState::SHOWDOWN:      return "Showdown";
+        case ELogicState::HAND_FINISHED: return "Hand Finished";
+        default:                         return "Unknown State";
+    }
+}
+
 };
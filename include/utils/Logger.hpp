@@ -1,12 +1,24 @@
 #pragma once
 
-#include <iostream>
-#include <chrono>
-#include <string>
-#include <iomanip>
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <format>
+#include <iosfwd>
+#include <new>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Lowest severity compiled in: 0 DEBUG, 1 INFO, 2 WARNING, 3 ERROR.
+// CMake sets it from POKER_LOG_MIN_LEVEL.
+#ifndef POKER_LOG_MIN_SEVERITY
+#define POKER_LOG_MIN_SEVERITY 0
+#endif
 
 enum class LogLevel {
     INFO,
@@ -15,15 +27,175 @@ enum class LogLevel {
     DEBUG
 };
 
+namespace log_detail {
+
+// String arguments are copied into the record (truncated), since the
+// caller's buffer may be gone by the time the writer formats it.
+struct LogString {
+    static constexpr std::size_t kCapacity = 47;
+
+    std::uint8_t size{0};
+    std::array<char, kCapacity> data{};
+
+    explicit LogString(std::string_view text) noexcept
+        : size(static_cast<std::uint8_t>(std::min(text.size(), kCapacity))) {
+        text.copy(data.data(), size);
+    }
+
+    std::string_view View() const noexcept { return {data.data(), size}; }
+};
+
+template <typename T>
+inline constexpr bool kIsLogString =
+    !std::is_arithmetic_v<std::decay_t<T>> && std::is_convertible_v<const T&, std::string_view>;
+
+template <typename T>
+using Stored_t = std::conditional_t<kIsLogString<T>, LogString, std::decay_t<T>>;
+
+template <typename T>
+Stored_t<T> Store(const T& value) noexcept {
+    if constexpr (kIsLogString<T>) return LogString(std::string_view(value));
+    else return value;
+}
+
+template <typename T>
+const auto& View(const T& stored) noexcept { return stored; }
+inline std::string_view View(const LogString& stored) noexcept { return stored.View(); }
+
+// One log call in binary form: the arguments are stored as values and only
+// formatted by the writer thread.
+struct LogRecord {
+    static constexpr std::size_t kPayloadSize = 192;
+    using Format_t = std::string (*)(std::string_view fmt, const std::byte* payload);
+
+    std::int64_t time_ns{0}; // system_clock, since epoch
+    std::string_view fmt;    // Always a string literal.
+    Format_t format{nullptr};
+    LogLevel level{LogLevel::INFO};
+    alignas(std::max_align_t) std::array<std::byte, kPayloadSize> payload;
+};
+
+template <typename... Args>
+std::string FormatPayload(std::string_view fmt, const std::byte* payload) {
+    using Tuple_t = std::tuple<Stored_t<Args>...>;
+    const auto& stored = *std::launder(reinterpret_cast<const Tuple_t*>(payload));
+    return std::apply([&](const auto&... values) {
+        auto views = std::make_tuple(View(values)...);
+        return std::apply([&](auto&... args) {
+            return std::vformat(fmt, std::make_format_args(args...));
+        }, views);
+    }, stored);
+}
+
+// Single-producer / single-consumer ring of records. The owning thread
+// pushes without locking; the writer drains. When full, records are
+// dropped and counted rather than blocking the caller.
+class LogRing {
+public:
+    static constexpr std::size_t kCapacity = 1024;
+    static_assert((kCapacity & (kCapacity - 1)) == 0, "Capacity must be a power of two");
+
+    // Producer side.
+    LogRecord* TryReserve() noexcept {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head - tail_cache_ == kCapacity) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head - tail_cache_ == kCapacity) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+        }
+        return &slots_[head & (kCapacity - 1)];
+    }
+
+    void Commit() noexcept {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Consumer side; one consumer at a time.
+    template <typename F>
+    std::size_t Drain(F&& consume) {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto head = head_.load(std::memory_order_acquire);
+        for (auto i = tail; i != head; ++i) {
+            consume(slots_[i & (kCapacity - 1)]);
+        }
+        tail_.store(head, std::memory_order_release);
+        return static_cast<std::size_t>(head - tail);
+    }
+
+    std::uint64_t TakeDropped() noexcept {
+        return dropped_.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+    std::uint64_t tail_cache_{0}; // Producer's last view of tail_.
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::array<LogRecord, kCapacity> slots_;
+};
+
+// This thread's ring, registered with the writer on first use and retired
+// when the thread exits. Null only while the thread is being torn down.
+LogRing* ThisThreadRing();
+std::int64_t NowNs() noexcept;
+
+} // namespace log_detail
+
+// Asynchronous logger. A call stores its arguments in the calling thread's
+// lock-free ring; a background thread formats and writes them. Levels below
+// POKER_LOG_MIN_SEVERITY are compiled out by the POKER_LOG_* macros,
+// argument evaluation included; SetMinLevel filters the rest at run time.
 class Logger {
 public:
+    // Messages below this level are dropped. Severity goes DEBUG < INFO < WARNING < ERROR.
+    static void SetMinLevel(LogLevel level) noexcept {
+        min_level_.store(level, std::memory_order_relaxed);
+    }
+
+    static LogLevel GetMinLevel() noexcept {
+        return min_level_.load(std::memory_order_relaxed);
+    }
+
+    static constexpr bool IsCompiledIn(LogLevel level) noexcept {
+        return Severity(level) >= POKER_LOG_MIN_SEVERITY;
+    }
+
+    static bool IsEnabled(LogLevel level) noexcept {
+        return IsCompiledIn(level)
+            && Severity(level) >= Severity(min_level_.load(std::memory_order_relaxed));
+    }
+
+    // Where the writer thread puts formatted lines; std::cout by default.
+    static void SetSink(std::ostream& sink);
+    // Writes every record pushed so far and flushes the sink.
+    static void Flush();
+
     template <typename... Args>
     static void Log(LogLevel level, std::format_string<Args...> fmt, Args&&... args) {
-        std::cout << "[" << CurrentTime() << "] "
-                  << "[" << ToString(level) << "] "
-                  << std::format(fmt, std::forward<Args>(args)...) << std::endl;
+        if (!IsEnabled(level)) return;
+
+        using Tuple_t = std::tuple<log_detail::Stored_t<Args>...>;
+        static_assert(sizeof(Tuple_t) <= log_detail::LogRecord::kPayloadSize, "Too many log arguments");
+        static_assert(std::is_trivially_destructible_v<Tuple_t>,
+                      "Log arguments must be strings or trivially copyable values");
+
+        auto* ring = log_detail::ThisThreadRing();
+        if (ring == nullptr) return;
+        auto* record = ring->TryReserve();
+        if (record == nullptr) return;
+
+        record->time_ns = log_detail::NowNs();
+        record->fmt = fmt.get();
+        record->format = &log_detail::FormatPayload<Args...>;
+        record->level = level;
+        ::new (record->payload.data()) Tuple_t(log_detail::Store(args)...);
+        ring->Commit();
     }
 
+    // The arguments of these are evaluated even when the level is off;
+    // prefer the POKER_LOG_* macros on hot paths.
     template <typename... Args>
     static void Info(std::format_string<Args...> fmt, Args&&... args) {
         Log(LogLevel::INFO, fmt, std::forward<Args>(args)...);
@@ -44,19 +216,7 @@ public:
         Log(LogLevel::DEBUG, fmt, std::forward<Args>(args)...);
     }
 
-private:
-    static std::string CurrentTime() {
-        const auto now = std::chrono::system_clock::now();
-        const auto time = std::chrono::system_clock::to_time_t(now);
-        const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
-
-        std::ostringstream oss;
-        oss << std::put_time(std::localtime(&time), "%H:%M:S")
-            << "." << std::setfill('0') << std::setw(3) << ms.count();
-        return oss.str();
-    }
-
-    static std::string ToString(LogLevel level) {
+    static std::string_view ToString(LogLevel level) noexcept {
         switch(level) {
             case LogLevel::INFO:    return "INFO";
             case LogLevel::WARNING: return "WARNING";
@@ -64,6 +224,50 @@ private:
             case LogLevel::DEBUG:   return "DEBUG";
             default:                return "UNKNOWN LEVEL";
         }
-    } 
+    }
+
+private:
+    static inline std::atomic<LogLevel> min_level_ {LogLevel::DEBUG};
+
+    static constexpr int Severity(LogLevel level) noexcept {
+        switch(level) {
+            case LogLevel::DEBUG:   return 0;
+            case LogLevel::INFO:    return 1;
+            case LogLevel::WARNING: return 2;
+            case LogLevel::ERROR:   return 3;
+            default:                return 3;
+        }
+    }
+};
+
+// Sets the run-time minimum level for its lifetime, then restores the
+// previous one. Tests and benchmarks use it to quiet the per-bet logging.
+class ScopedLogLevel {
+public:
+    explicit ScopedLogLevel(LogLevel level) noexcept
+        : previous_(Logger::GetMinLevel()) {
+        Logger::SetMinLevel(level);
+    }
+
+    ~ScopedLogLevel() { Logger::SetMinLevel(previous_); }
+
+    ScopedLogLevel(const ScopedLogLevel&) = delete;
+    ScopedLogLevel& operator=(const ScopedLogLevel&) = delete;
+
+private:
+    LogLevel previous_;
+};
+
+// Nothing of a call below the compiled-in level survives, not even its
+// arguments; a call filtered at run time skips argument evaluation too.
+#define POKER_LOG(level, ...)                                            \
+    do {                                                                 \
+        if constexpr (Logger::IsCompiledIn(level)) {                     \
+            if (Logger::IsEnabled(level)) Logger::Log(level, __VA_ARGS__); \
+        }                                                                \
+    } while (false)
 
-};
\ No newline at end of file
+#define POKER_LOG_DEBUG(...)   POKER_LOG(LogLevel::DEBUG, __VA_ARGS__)
+#define POKER_LOG_INFO(...)    POKER_LOG(LogLevel::INFO, __VA_ARGS__)
+#define POKER_LOG_WARNING(...) POKER_LOG(LogLevel::WARNING, __VA_ARGS__)
+#define POKER_LOG_ERROR(...)   POKER_LOG(LogLevel::ERROR, __VA_ARGS__)
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+// Vector-like container with a fixed capacity and inline storage.
+// It never allocates; pushing beyond the capacity is a programming error.
+
+template <typename T, std::size_t N>
+class StaticVector {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr StaticVector() noexcept = default;
+
+    constexpr StaticVector(std::initializer_list<T> values) noexcept {
+        assert(values.size() <= N && "StaticVector capacity exceeded");
+        for (const auto& value : values) push_back(value);
+    }
+
+    [[nodiscard]] static constexpr size_type capacity() noexcept { return N; }
+    [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] constexpr bool full() const noexcept { return size_ == N; }
+
+    constexpr void push_back(const T& value) noexcept {
+        assert(size_ < N && "StaticVector capacity exceeded");
+        data_[size_++] = value;
+    }
+
+    template <typename... Args>
+    constexpr T& emplace_back(Args&&... args) {
+        assert(size_ < N && "StaticVector capacity exceeded");
+        data_[size_] = T(std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    constexpr void pop_back() noexcept {
+        assert(size_ > 0);
+        --size_;
+    }
+
+    constexpr void clear() noexcept { size_ = 0; }
+
+    constexpr T& operator[](size_type i) noexcept { return data_[i]; }
+    constexpr const T& operator[](size_type i) const noexcept { return data_[i]; }
+
+    constexpr T& front() noexcept { return data_[0]; }
+    constexpr const T& front() const noexcept { return data_[0]; }
+    constexpr T& back() noexcept { return data_[size_ - 1]; }
+    constexpr const T& back() const noexcept { return data_[size_ - 1]; }
+
+    constexpr T* data() noexcept { return data_.data(); }
+    constexpr const T* data() const noexcept { return data_.data(); }
+
+    constexpr iterator begin() noexcept { return data_.data(); }
+    constexpr iterator end() noexcept { return data_.data() + size_; }
+    constexpr const_iterator begin() const noexcept { return data_.data(); }
+    constexpr const_iterator end() const noexcept { return data_.data() + size_; }
+
+    friend constexpr bool operator==(const StaticVector& lhs, const StaticVector& rhs) noexcept {
+        if (lhs.size_ != rhs.size_) return false;
+        for (size_type i = 0; i < lhs.size_; ++i) {
+            if (!(lhs.data_[i] == rhs.data_[i])) return false;
+        }
+        return true;
+    }
+
+private:
+    using Size_t = std::conditional_t<(N <= UINT8_MAX), std::uint8_t, std::size_t>;
+
+    std::array<T, N> data_{};
+    Size_t size_{0};
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads with one task deque each (work stealing).
+// A worker pops its own deque from the back and, when it runs dry, steals
+// from the front of the others. Tasks submitted from outside the pool are
+// spread round-robin; tasks submitted from inside a task go to the running
+// worker's own deque.
+// Tasks receive the index of the worker running them, so callers can keep
+// per-worker state (RNG streams, accumulators) without locking.
+
+class ThreadPool {
+public:
+    using Task_t = std::function<void(std::size_t worker_index)>;
+
+    explicit ThreadPool(std::size_t thread_count = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(Task_t task);
+
+    // Blocks until every submitted task has finished. Rethrows the first
+    // exception thrown by a task, if any. Must not be called from a task.
+    void Wait();
+
+    std::size_t GetThreadCount() const noexcept;
+
+private:
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task_t> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::atomic<std::size_t> next_queue_{0};
+    std::atomic<std::size_t> queued_tasks_{0};  // Sitting in a deque.
+    std::atomic<std::size_t> pending_tasks_{0}; // Submitted and not finished.
+
+    std::mutex mutex_; // Guards sleeping, stopping_ and first_error_.
+    std::condition_variable task_available_;
+    std::condition_variable all_done_;
+    std::exception_ptr first_error_;
+    bool stopping_{false};
+
+    bool TryPop(std::size_t worker_index, Task_t& task);
+    void Run(Task_t& task, std::size_t worker_index);
+    void WorkerLoop(std::size_t worker_index);
+};
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define POKER_TRACE_TSC 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define POKER_TRACE_TSC 1
+#else
+#define POKER_TRACE_TSC 0
+#endif
+
+// Chrome trace / Perfetto spans. Build with POKER_ENABLE_TRACING (CMake) to
+// compile the POKER_TRACE_SCOPE macros in; without it they expand to
+// nothing. Even when compiled in, spans are only recorded after
+// Tracer::SetEnabled(true). Each thread appends complete events to its own
+// buffer with no locking; WriteChromeJson dumps all of them for
+// chrome://tracing or ui.perfetto.dev.
+
+#ifndef POKER_TRACING
+#define POKER_TRACING 0
+#endif
+
+// Times are in Tracer::Now ticks; WriteChromeJson converts them.
+struct TraceEvent {
+    const char* name; // Always a string literal.
+    std::int64_t start_ticks;
+    std::int64_t duration_ticks;
+};
+
+// Events of one thread. Only the owning thread appends; size_ is published
+// with release so a dump from another thread sees whole events. Once full,
+// further events are counted as dropped.
+class TraceBuffer {
+public:
+    static constexpr std::size_t kCapacity = std::size_t{1} << 18;
+
+    explicit TraceBuffer(std::uint32_t thread_id)
+        : events_(std::make_unique_for_overwrite<TraceEvent[]>(kCapacity)), thread_id_(thread_id) {}
+
+    void Push(const TraceEvent& event) noexcept {
+        const auto size = size_.load(std::memory_order_relaxed);
+        if (size == capacity_) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        events_[size] = event;
+        size_.store(size + 1, std::memory_order_release);
+    }
+
+    std::size_t GetSize() const noexcept { return size_.load(std::memory_order_acquire); }
+    const TraceEvent& operator[](std::size_t i) const noexcept { return events_[i]; }
+    std::uint32_t GetThreadId() const noexcept { return thread_id_; }
+    std::uint64_t GetDropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    void Clear() noexcept {
+        size_.store(0, std::memory_order_relaxed);
+        dropped_.store(0, std::memory_order_relaxed);
+    }
+
+    // Keeps only the recorded events; for when the owning thread has exited.
+    void ShrinkToFit() {
+        const auto size = GetSize();
+        auto events = std::make_unique_for_overwrite<TraceEvent[]>(size);
+        std::copy_n(events_.get(), size, events.get());
+        events_ = std::move(events);
+        capacity_ = size;
+    }
+
+private:
+    std::unique_ptr<TraceEvent[]> events_;
+    std::size_t capacity_{kCapacity};
+    std::atomic<std::size_t> size_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::uint32_t thread_id_;
+};
+
+class Tracer {
+public:
+    static constexpr bool kCompiledIn = POKER_TRACING != 0;
+
+    // Enabling also creates the calling thread's buffer.
+    static void SetEnabled(bool enabled);
+
+    static bool IsEnabled() noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    // The time stamp counter where there is one: a span then costs two
+    // register reads instead of two clock calls.
+    static std::int64_t Now() noexcept {
+#if POKER_TRACE_TSC
+        return static_cast<std::int64_t>(__rdtsc());
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // Creates this thread's buffer ahead of its first span, so that the
+    // allocation stays out of measured code. The buffer is trimmed to its
+    // events when the thread exits.
+    static void RegisterThisThread();
+    // This thread's buffer, registering the thread if needed.
+    static TraceBuffer& ThisThreadBuffer();
+    // Appends to this thread's buffer; used by TraceSpan.
+    static void Record(const TraceEvent& event);
+
+    // Chrome trace event format ("X" complete events, times in microseconds).
+    static void WriteChromeJson(std::ostream& out);
+    // Events lost to full buffers since the last Clear, over all threads.
+    static std::uint64_t GetDropped();
+    // Drops every recorded event. No span may be closing meanwhile.
+    static void Clear();
+
+private:
+    static inline std::atomic<bool> enabled_{false};
+};
+
+// Records [construction, destruction) as one complete event.
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name) noexcept
+        : name_(name), start_(Tracer::IsEnabled() ? Tracer::Now() : -1) {}
+
+    ~TraceSpan() {
+        if (start_ < 0) return;
+        Tracer::Record({name_, start_, Tracer::Now() - start_});
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* name_;
+    std::int64_t start_;
+};
+
+#define POKER_TRACE_CONCAT_IMPL(a, b) a##b
+#define POKER_TRACE_CONCAT(a, b) POKER_TRACE_CONCAT_IMPL(a, b)
+
+#if POKER_TRACING
+#define POKER_TRACE_SCOPE(name) const TraceSpan POKER_TRACE_CONCAT(poker_trace_span_, __LINE__)(name)
+#else
+#define POKER_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
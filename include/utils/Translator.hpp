@@ -3,12 +3,13 @@
 #include <phevaluator/phevaluator.h>
 
 #include "core/Card.hpp"
+#include "core/CardSet.hpp"
 #include "table/PlayerSession.hpp"
 
 #include <string>
 #include <cassert>
 #include <array>
-#include <vector>
+#include <span>
 
 // This file will help us to translate our code to what
 // PokerHandEvaluator module expects.
@@ -43,36 +44,65 @@ inline std::string FromCustomCardToPhevaluatorCard(const Card& card) {
     return card_name;
 }
 
+// phevaluator identifies a card by the integer rank * 4 + suit, where ranks
+// 2..A map to 0..12 and suits are ordered Clubs, Diamonds, Hearts, Spades.
+// Our packed Card id already follows that layout, so no string round trip
+// (and no parsing) is needed.
+inline constexpr int FromCustomCardToPhevaluatorId(const Card& card) noexcept {
+    return card.GetId();
+}
+
 inline phevaluator::Rank RankFromPlayerTableCards(
-    const PlayerSession::Hand_t& player_cards, const std::vector<Card>& community_cards) {
+    const PlayerSession::Hand_t& player_cards, std::span<const Card> community_cards) {
+    const phevaluator::Card a = FromCustomCardToPhevaluatorId(player_cards[0]);
+    const phevaluator::Card b = FromCustomCardToPhevaluatorId(player_cards[1]);
     switch(community_cards.size()) {
         case 3: 
             return phevaluator::EvaluateCards(
-                FromCustomCardToPhevaluatorCard(player_cards[0]),
-                FromCustomCardToPhevaluatorCard(player_cards[1]),
-                FromCustomCardToPhevaluatorCard(community_cards[0]),
-                FromCustomCardToPhevaluatorCard(community_cards[1]),
-                FromCustomCardToPhevaluatorCard(community_cards[2]));
+                a, b,
+                FromCustomCardToPhevaluatorId(community_cards[0]),
+                FromCustomCardToPhevaluatorId(community_cards[1]),
+                FromCustomCardToPhevaluatorId(community_cards[2]));
         case 4:
             return phevaluator::EvaluateCards(
-                FromCustomCardToPhevaluatorCard(player_cards[0]),
-                FromCustomCardToPhevaluatorCard(player_cards[1]),
-                FromCustomCardToPhevaluatorCard(community_cards[0]),
-                FromCustomCardToPhevaluatorCard(community_cards[1]),
-                FromCustomCardToPhevaluatorCard(community_cards[2]),
-                FromCustomCardToPhevaluatorCard(community_cards[3]));
+                a, b,
+                FromCustomCardToPhevaluatorId(community_cards[0]),
+                FromCustomCardToPhevaluatorId(community_cards[1]),
+                FromCustomCardToPhevaluatorId(community_cards[2]),
+                FromCustomCardToPhevaluatorId(community_cards[3]));
         case 5:
             return phevaluator::EvaluateCards(
-                FromCustomCardToPhevaluatorCard(player_cards[0]),
-                FromCustomCardToPhevaluatorCard(player_cards[1]),
-                FromCustomCardToPhevaluatorCard(community_cards[0]),
-                FromCustomCardToPhevaluatorCard(community_cards[1]),
-                FromCustomCardToPhevaluatorCard(community_cards[2]),
-                FromCustomCardToPhevaluatorCard(community_cards[3]),
-                FromCustomCardToPhevaluatorCard(community_cards[4]));
+                a, b,
+                FromCustomCardToPhevaluatorId(community_cards[0]),
+                FromCustomCardToPhevaluatorId(community_cards[1]),
+                FromCustomCardToPhevaluatorId(community_cards[2]),
+                FromCustomCardToPhevaluatorId(community_cards[3]),
+                FromCustomCardToPhevaluatorId(community_cards[4]));
         default:
             assert(false && "More community cards than expected");
             return {};
     }
 }
+
+// Same evaluation from a set of 5 to 7 cards, e.g. hand set | board set.
+inline phevaluator::Rank RankFromCardSet(CardSet cards) {
+    std::array<phevaluator::Card, 7> ids{};
+    std::size_t count = 0;
+    for (const auto card : cards) {
+        if (count == ids.size()) break;
+        ids[count++] = FromCustomCardToPhevaluatorId(card);
+    }
+
+    switch(count) {
+        case 5:
+            return phevaluator::EvaluateCards(ids[0], ids[1], ids[2], ids[3], ids[4]);
+        case 6:
+            return phevaluator::EvaluateCards(ids[0], ids[1], ids[2], ids[3], ids[4], ids[5]);
+        case 7:
+            return phevaluator::EvaluateCards(ids[0], ids[1], ids[2], ids[3], ids[4], ids[5], ids[6]);
+        default:
+            assert(false && "Expected between 5 and 7 cards");
+            return {};
+    }
+}
 }
\ No newline at end of file
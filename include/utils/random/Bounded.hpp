@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <utility>
+
+// Uniform integer in [0, bound) from a 64-bit generator, using Lemire's
+// multiply-and-shift method: one multiplication per draw and a division
+// only on the rare rejection path. bound must be greater than zero.
+template <typename Engine>
+[[nodiscard]] constexpr std::uint64_t UniformBelow(Engine& engine, std::uint64_t bound) noexcept {
+#if defined(__SIZEOF_INT128__)
+    using Wide_t = unsigned __int128;
+    Wide_t product = static_cast<Wide_t>(engine()) * bound;
+    auto low = static_cast<std::uint64_t>(product);
+    if (low < bound) {
+        const std::uint64_t threshold = (0 - bound) % bound;
+        while (low < threshold) {
+            product = static_cast<Wide_t>(engine()) * bound;
+            low = static_cast<std::uint64_t>(product);
+        }
+    }
+    return static_cast<std::uint64_t>(product >> 64);
+#else
+    return std::uniform_int_distribution<std::uint64_t>(0, bound - 1)(engine);
+#endif
+}
+
+// Fisher-Yates shuffle on top of UniformBelow.
+template <typename Engine, typename T>
+constexpr void ShuffleWith(Engine& engine, std::span<T> values) noexcept {
+    for (std::size_t i = values.size(); i > 1; --i) {
+        const auto j = static_cast<std::size_t>(UniformBelow(engine, i));
+        std::swap(values[i - 1], values[j]);
+    }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "utils/random/SplitMix64.hpp"
+
+#include <array>
+#include <cstdint>
+
+// Counter-based generator: number n of stream `key` is a pure function of
+// (key, n), here two SplitMix64 finaliser rounds over the counter keyed by
+// the stream. There is no state to expand, so creating one per hand or per
+// table costs nothing, and skipping ahead is an addition.
+// Satisfies std::uniform_random_bit_generator.
+
+class CounterRng {
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return UINT64_MAX; }
+
+    // Mixed key and counter, in that order.
+    using State_t = std::array<std::uint64_t, 2>;
+
+    constexpr explicit CounterRng(std::uint64_t key = 0, std::uint64_t counter = 0) noexcept
+        : key_(Mix64(key + SplitMix64::kGamma)), counter_(counter) {}
+
+    // Resumes a stream captured with GetState.
+    constexpr explicit CounterRng(const State_t& state) noexcept
+        : key_(state[0]), counter_(state[1]) {}
+
+    constexpr result_type operator()() noexcept {
+        return Mix64(Mix64(counter_++ * SplitMix64::kGamma) ^ key_);
+    }
+
+    constexpr void Discard(std::uint64_t count) noexcept { counter_ += count; }
+
+    // An independent stream derived from this one's key.
+    [[nodiscard]] constexpr CounterRng Split(std::uint64_t stream) const noexcept {
+        CounterRng child;
+        child.key_ = Mix64(key_ ^ Mix64(stream + SplitMix64::kGamma));
+        return child;
+    }
+
+    [[nodiscard]] constexpr std::uint64_t GetCounter() const noexcept { return counter_; }
+    [[nodiscard]] constexpr State_t GetState() const noexcept { return {key_, counter_}; }
+
+    friend constexpr bool operator==(const CounterRng&, const CounterRng&) noexcept = default;
+
+private:
+    std::uint64_t key_;
+    std::uint64_t counter_;
+};
@@ -2,10 +2,28 @@
 
 #include "core/Card.hpp"
 
-#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+// Raw generator state, large enough for the 64-bit engines in this directory.
+using RandomState = std::array<std::uint64_t, 4>;
 
 class IRandomProvider {
 public:
     virtual ~IRandomProvider() = default;
-    virtual void Shuffle(std::vector<Card>& cards) = 0;
+    virtual void Shuffle(std::span<Card> cards) = 0;
+    // Uniform integer in [0, bound). bound must be greater than zero.
+    // Never throws, so Deck::Draw can stay noexcept.
+    [[nodiscard]] virtual std::size_t UniformIndex(std::size_t bound) noexcept = 0;
+    // Restarts the stream as if freshly constructed with this seed.
+    virtual void Reseed(std::uint64_t seed) = 0;
+
+    // Position in the stream, for snapshots. Empty when the generator does
+    // not fit in a RandomState (std::mt19937).
+    [[nodiscard]] virtual std::optional<RandomState> SaveState() const noexcept { return std::nullopt; }
+    // Takes a state this provider returned from SaveState.
+    virtual void RestoreState(const RandomState& /*state*/) noexcept {}
 };
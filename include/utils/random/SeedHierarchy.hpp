@@ -0,0 +1,21 @@
+#pragma once
+
+#include "utils/random/SplitMix64.hpp"
+
+#include <cstdint>
+
+// Deterministic seed tree: master seed -> table id -> hand number. Every
+// node is a pure function of its path, so any hand of any table can be
+// re-dealt on its own, whatever thread or order it originally ran in.
+
+[[nodiscard]] constexpr std::uint64_t DeriveSeed(std::uint64_t parent, std::uint64_t child) noexcept {
+    return Mix64(parent ^ Mix64(child + SplitMix64::kGamma));
+}
+
+[[nodiscard]] constexpr std::uint64_t DeriveTableSeed(std::uint64_t master, std::uint64_t table) noexcept {
+    return DeriveSeed(master, table);
+}
+
+[[nodiscard]] constexpr std::uint64_t DeriveHandSeed(std::uint64_t master, std::uint64_t table, std::uint64_t hand) noexcept {
+    return DeriveSeed(DeriveTableSeed(master, table), hand);
+}
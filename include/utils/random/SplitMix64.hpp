@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+// SplitMix64 (Steele, Lea, Flood). Used to expand one 64-bit seed into the
+// state of larger generators and to hash seeds into unrelated values.
+
+[[nodiscard]] constexpr std::uint64_t Mix64(std::uint64_t z) noexcept {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+class SplitMix64 {
+public:
+    using result_type = std::uint64_t;
+    static constexpr std::uint64_t kGamma = 0x9E3779B97F4A7C15ULL;
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return UINT64_MAX; }
+
+    constexpr explicit SplitMix64(std::uint64_t seed = 0) noexcept : state_(seed) {}
+
+    constexpr result_type operator()() noexcept {
+        state_ += kGamma;
+        return Mix64(state_);
+    }
+
+private:
+    std::uint64_t state_;
+};
@@ -2,12 +2,15 @@
 
 #include "utils/random/IRandomProvider.hpp"
 
+#include <cstdint>
 #include <random>
 
 class StdRandomProvider : public IRandomProvider {
 public:
     explicit StdRandomProvider(uint64_t seed = std::random_device{}());
-    void Shuffle(std::vector<Card>& cards) override;
+    void Shuffle(std::span<Card> cards) override;
+    [[nodiscard]] std::size_t UniformIndex(std::size_t bound) noexcept override;
+    void Reseed(std::uint64_t seed) override;
 
 private:
     std::mt19937 rng_;
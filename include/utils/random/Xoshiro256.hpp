@@ -0,0 +1,92 @@
+#pragma once
+
+#include "utils/random/SplitMix64.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+// xoshiro256** (Blackman, Vigna): 32 bytes of state, a handful of cycles per
+// number and a period of 2^256 - 1. Jump() advances 2^128 steps, so a seed
+// can be cut into 2^128 non-overlapping streams (one per thread or table).
+// Satisfies std::uniform_random_bit_generator.
+
+class Xoshiro256StarStar {
+public:
+    using result_type = std::uint64_t;
+    using State_t = std::array<std::uint64_t, 4>;
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return UINT64_MAX; }
+
+    constexpr explicit Xoshiro256StarStar(std::uint64_t seed = 0) noexcept {
+        Seed(seed);
+    }
+
+    constexpr explicit Xoshiro256StarStar(const State_t& state) noexcept
+        : state_(state) {}
+
+    constexpr void Seed(std::uint64_t seed) noexcept {
+        SplitMix64 expand(seed);
+        for (auto& word : state_) word = expand();
+    }
+
+    constexpr result_type operator()() noexcept {
+        const auto result = std::rotl(state_[1] * 5, 7) * 9;
+        const auto t = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = std::rotl(state_[3], 45);
+
+        return result;
+    }
+
+    // Equivalent to 2^128 calls.
+    constexpr void Jump() noexcept {
+        constexpr State_t kJump {
+            0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+            0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+        };
+        ApplyJump(kJump);
+    }
+
+    // Equivalent to 2^192 calls.
+    constexpr void LongJump() noexcept {
+        constexpr State_t kLongJump {
+            0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL,
+            0x77710069854EE241ULL, 0x39109BB02ACBE635ULL
+        };
+        ApplyJump(kLongJump);
+    }
+
+    // Hands out the current stream and moves this generator to the next one.
+    [[nodiscard]] constexpr Xoshiro256StarStar Split() noexcept {
+        auto child = *this;
+        Jump();
+        return child;
+    }
+
+    [[nodiscard]] constexpr const State_t& GetState() const noexcept { return state_; }
+
+    friend constexpr bool operator==(const Xoshiro256StarStar&, const Xoshiro256StarStar&) noexcept = default;
+
+private:
+    State_t state_{};
+
+    constexpr void ApplyJump(const State_t& polynomial) noexcept {
+        State_t jumped{};
+        for (const auto word : polynomial) {
+            for (int bit = 0; bit < 64; ++bit) {
+                if (word & (std::uint64_t{1} << bit)) {
+                    for (std::size_t i = 0; i < jumped.size(); ++i) jumped[i] ^= state_[i];
+                }
+                (*this)();
+            }
+        }
+        state_ = jumped;
+    }
+};
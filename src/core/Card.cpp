@@ -5,29 +5,10 @@
 #include <cassert>
 #include <sstream>
 
-Card::Card() noexcept 
-    : suit_(ECardSuit::SPADES), rank_(ECardRank::ACE) {}
-
-Card::Card(ECardSuit suit, ECardRank rank) noexcept 
-    : suit_(suit), rank_(rank) {}
-
-ECardSuit Card::GetSuit() const noexcept {
-    return suit_;
-}
-
-ECardRank Card::GetRank() const noexcept {
-    return rank_;
-}
-
-bool Card::operator==(const Card& other) const noexcept {
-    return (GetSuit() == other.GetSuit() &&
-            GetRank() == other.GetRank());
-}
-
 std::string Card::ToString() const noexcept {
     std::ostringstream oss;
     oss << "Card {"
-        << EnumString::ToString(rank_) << "-"
-        << EnumString::ToString(suit_) << "}";
+        << EnumString::ToString(GetRank()) << "-"
+        << EnumString::ToString(GetSuit()) << "}";
     return oss.str();
-}
\ No newline at end of file
+}
@@ -1,19 +1,52 @@
 #include "core/Deck.hpp"
 
-Deck::Deck(Deck::DeckCards_t cards, IRandomProvider& rng)  noexcept
-    : cards_(cards), rng_(rng), next_card_index_(0) {}
+#include <algorithm>
+#include <cassert>
+
+Deck::Deck(std::span<const Card> cards, IRandomProvider& rng, EDeckMode mode) noexcept
+    : cards_{}, cards_count_(std::min(cards.size(), kMaxCards)), rng_(rng), next_card_index_(0), mode_(mode) {
+    assert(cards.size() <= kMaxCards && "Deck holds at most one full set of cards");
+    std::copy_n(cards.begin(), cards_count_, cards_.begin());
+}
     
 void Deck::Shuffle() noexcept {
-    rng_.Shuffle(cards_);
+    // Deal-on-demand decks randomise as they are drawn.
+    if (mode_ == EDeckMode::SHUFFLE_ALL) {
+        rng_.Shuffle(std::span<Card>(cards_.data(), cards_count_));
+    }
     next_card_index_ = 0;
 }
 
-std::optional<Card> Deck::Draw() noexcept {
-    if (next_card_index_ >= cards_.size()) return std::nullopt;
+Deck::DeckCards_t Deck::GetCards() const noexcept {
+    return {cards_.data(), cards_count_};
+}
 
-    return cards_[next_card_index_++];
+DeckState Deck::SaveState() const noexcept {
+    DeckState state;
+    state.cards = cards_;
+    state.cards_count = static_cast<std::uint8_t>(cards_count_);
+    state.next_card_index = static_cast<std::uint8_t>(next_card_index_);
+    state.mode = mode_;
+    if (mode_ == EDeckMode::DEAL_ON_DEMAND) {
+        if (const auto rng_state = rng_.SaveState()) {
+            state.has_rng_state = true;
+            state.rng_state = *rng_state;
+        }
+    }
+    return state;
 }
 
-const Deck::DeckCards_t& Deck::GetCards() const noexcept {
-    return cards_;
-}
\ No newline at end of file
+bool Deck::RestoreState(const DeckState& state) noexcept {
+    if (!state.CanRestore()) return false;
+
+    cards_ = state.cards;
+    cards_count_ = state.cards_count;
+    next_card_index_ = state.next_card_index;
+    mode_ = state.mode;
+    if (state.has_rng_state) rng_.RestoreState(state.rng_state);
+    return true;
+}
+
+EDeckMode Deck::GetMode() const noexcept {
+    return mode_;
+}
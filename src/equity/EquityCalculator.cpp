@@ -0,0 +1,311 @@
+#include "equity/EquityCalculator.hpp"
+
+#include <phevaluator/phevaluator.h>
+
+#include "utils/Translator.hpp"
+#include "utils/random/Bounded.hpp"
+#include "utils/random/Xoshiro256.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kBoardSize = ITable::kMaxCommunityCards;
+constexpr std::size_t kEvaluatedCards = kBoardSize + 2;
+
+using CardIds_t = std::array<int, kEvaluatedCards>;
+
+struct alignas(64) Tally {
+    std::array<std::uint64_t, EquityInput::kMaxPlayers> wins{};
+    std::array<std::array<std::uint64_t, EquityInput::kMaxPlayers + 1>, EquityInput::kMaxPlayers> ties{};
+
+    void Merge(const Tally& other) noexcept {
+        for (std::size_t i = 0; i < wins.size(); ++i) {
+            wins[i] += other.wins[i];
+            for (std::size_t k = 0; k < ties[i].size(); ++k) {
+                ties[i][k] += other.ties[i][k];
+            }
+        }
+    }
+};
+
+// Everything a run-out needs, resolved once per calculation: the evaluator ids
+// of each player's hole cards and known board, and the cards left to deal.
+struct Spot {
+    std::size_t players_count{0};
+    std::size_t known_board_count{0};
+    std::array<CardIds_t, EquityInput::kMaxPlayers> player_ids{};
+    StaticVector<Card, Card::kCount> remaining;
+
+    std::size_t GetMissingBoardCount() const noexcept {
+        return kBoardSize - known_board_count;
+    }
+};
+
+Spot PrepareSpot(const EquityInput& input) {
+    const auto players_count = input.players.size();
+    if (players_count < EquityInput::kMinPlayers || players_count > EquityInput::kMaxPlayers) {
+        throw std::invalid_argument("Equity needs between 2 and 10 players");
+    }
+
+    CardSet known;
+    const auto add_known = [&known](Card card) {
+        if (known.Contains(card)) {
+            throw std::invalid_argument("Card used twice in equity input: " + card.ToString());
+        }
+        known.Insert(card);
+    };
+
+    Spot spot;
+    spot.players_count = players_count;
+    spot.known_board_count = input.board.size();
+
+    for (std::size_t i = 0; i < players_count; ++i) {
+        const auto& hand = input.players[i].hand;
+        add_known(hand[0]);
+        add_known(hand[1]);
+        spot.player_ids[i][0] = Translator::FromCustomCardToPhevaluatorId(hand[0]);
+        spot.player_ids[i][1] = Translator::FromCustomCardToPhevaluatorId(hand[1]);
+    }
+
+    for (std::size_t b = 0; b < input.board.size(); ++b) {
+        add_known(input.board[b]);
+        const auto id = Translator::FromCustomCardToPhevaluatorId(input.board[b]);
+        for (std::size_t i = 0; i < players_count; ++i) {
+            spot.player_ids[i][2 + b] = id;
+        }
+    }
+
+    if (input.dead_cards.Intersects(known)) {
+        throw std::invalid_argument("Dead cards overlap hands or board");
+    }
+
+    for (const auto card : (known | input.dead_cards).Complement()) {
+        spot.remaining.push_back(card);
+    }
+
+    if (spot.remaining.size() < spot.GetMissingBoardCount()) {
+        throw std::invalid_argument("Not enough cards left to complete the board");
+    }
+
+    return spot;
+}
+
+int Evaluate(const CardIds_t& ids) {
+    return phevaluator::EvaluateCards(ids[0], ids[1], ids[2], ids[3], ids[4], ids[5], ids[6]).value();
+}
+
+// Scores one complete board (player_ids already hold all 7 cards per player).
+// phevaluator ranks are better when lower.
+void ScoreShowdown(const Spot& spot, const std::array<CardIds_t, EquityInput::kMaxPlayers>& player_ids, Tally& tally) {
+    std::array<int, EquityInput::kMaxPlayers> ranks{};
+    int best = std::numeric_limits<int>::max();
+    for (std::size_t i = 0; i < spot.players_count; ++i) {
+        ranks[i] = Evaluate(player_ids[i]);
+        best = std::min(best, ranks[i]);
+    }
+
+    std::size_t winners = 0;
+    for (std::size_t i = 0; i < spot.players_count; ++i) {
+        winners += (ranks[i] == best);
+    }
+
+    for (std::size_t i = 0; i < spot.players_count; ++i) {
+        if (ranks[i] != best) continue;
+        if (winners == 1) {
+            ++tally.wins[i];
+        } else {
+            ++tally.ties[i][winners];
+        }
+    }
+}
+
+Xoshiro256StarStar MakeChunkRng(std::uint64_t seed, std::uint64_t chunk) {
+    return Xoshiro256StarStar(seed ^ Mix64(chunk + SplitMix64::kGamma));
+}
+
+void RunMonteCarloChunk(const Spot& spot, std::uint64_t trials, Xoshiro256StarStar& rng, Tally& tally) {
+    auto remaining = spot.remaining;
+    auto player_ids = spot.player_ids;
+    const auto missing = spot.GetMissingBoardCount();
+    const auto remaining_count = remaining.size();
+
+    for (std::uint64_t t = 0; t < trials; ++t) {
+        // Partial Fisher-Yates: only the cards we need are drawn.
+        for (std::size_t j = 0; j < missing; ++j) {
+            const auto pick = j + static_cast<std::size_t>(UniformBelow(rng, remaining_count - j));
+            std::swap(remaining[j], remaining[pick]);
+
+            const auto id = Translator::FromCustomCardToPhevaluatorId(remaining[j]);
+            for (std::size_t i = 0; i < spot.players_count; ++i) {
+                player_ids[i][2 + spot.known_board_count + j] = id;
+            }
+        }
+        ScoreShowdown(spot, player_ids, tally);
+    }
+}
+
+// Counts boards while filling one more card per level. Each level writes its
+// card into every player's id prefix once, so a leaf only adds the last card
+// and runs the evaluator.
+void EnumerateBoards(
+    const Spot& spot, std::size_t depth, std::size_t first,
+    std::array<CardIds_t, EquityInput::kMaxPlayers>& player_ids, Tally& tally) {
+    const auto missing = spot.GetMissingBoardCount();
+    if (depth == missing) {
+        ScoreShowdown(spot, player_ids, tally);
+        return;
+    }
+
+    const auto slot = 2 + spot.known_board_count + depth;
+    const auto last = spot.remaining.size() - (missing - depth);
+    for (std::size_t i = first; i <= last; ++i) {
+        const auto id = Translator::FromCustomCardToPhevaluatorId(spot.remaining[i]);
+        for (std::size_t p = 0; p < spot.players_count; ++p) {
+            player_ids[p][slot] = id;
+        }
+        EnumerateBoards(spot, depth + 1, i + 1, player_ids, tally);
+    }
+}
+
+std::uint64_t CountBoards(std::size_t remaining, std::size_t missing) noexcept {
+    std::uint64_t boards = 1;
+    for (std::size_t k = 0; k < missing; ++k) {
+        boards = boards * (remaining - k) / (k + 1);
+    }
+    return boards;
+}
+
+EquityResult MakeResult(const EquityInput& input, const Tally& tally, std::uint64_t trials) {
+    EquityResult result;
+    result.trials = trials;
+    for (std::size_t i = 0; i < input.players.size(); ++i) {
+        auto& seat = result.seats.emplace_back();
+        seat.seat = input.players[i].seat;
+        seat.wins = tally.wins[i];
+        seat.ties = tally.ties[i];
+    }
+    return result;
+}
+
+} // namespace
+
+EquityInput EquityInput::FromTable(const PlayerList& player_list, const ITable& table) {
+    EquityInput input;
+    for (const auto seat_idx : player_list.GetActiveSeatIndices()) {
+        input.players.push_back({seat_idx, player_list.GetSession(seat_idx).GetHand()});
+    }
+    for (const auto card : table.GetCommunityCards()) {
+        input.board.push_back(card);
+    }
+    return input;
+}
+
+std::uint64_t SeatEquity::GetTies() const noexcept {
+    std::uint64_t total = 0;
+    for (const auto count : ties) total += count;
+    return total;
+}
+
+double SeatEquity::GetEquity(std::uint64_t trials) const noexcept {
+    if (trials == 0) return 0.0;
+
+    double share = static_cast<double>(wins);
+    for (std::size_t k = 2; k < ties.size(); ++k) {
+        share += static_cast<double>(ties[k]) / static_cast<double>(k);
+    }
+    return share / static_cast<double>(trials);
+}
+
+double EquityResult::GetEquity(std::size_t player_index) const noexcept {
+    return seats[player_index].GetEquity(trials);
+}
+
+EquityCalculator::EquityCalculator(std::size_t thread_count)
+    : pool_(thread_count) {}
+
+std::size_t EquityCalculator::GetThreadCount() const noexcept {
+    return pool_.GetThreadCount();
+}
+
+bool EquityCalculator::PrefersExhaustive(const EquityInput& input) noexcept {
+    const auto board_count = input.board.size();
+    return (board_count >= 4 || (board_count == 3 && input.players.size() <= 3));
+}
+
+EquityResult EquityCalculator::Run(
+    const EquityInput& input, std::uint64_t trials, std::uint64_t seed, EEquityMode mode) {
+    if (mode == EEquityMode::AUTO) {
+        mode = PrefersExhaustive(input) ? EEquityMode::EXHAUSTIVE : EEquityMode::MONTE_CARLO;
+    }
+
+    return (mode == EEquityMode::EXHAUSTIVE) ? RunExhaustive(input) : RunMonteCarlo(input, trials, seed);
+}
+
+EquityResult EquityCalculator::RunExhaustive(const EquityInput& input) {
+    const auto spot = PrepareSpot(input);
+    const auto missing = spot.GetMissingBoardCount();
+    const auto boards = CountBoards(spot.remaining.size(), missing);
+
+    Tally total;
+    if (missing == 0 || boards <= kInlineEnumerationLimit) {
+        auto player_ids = spot.player_ids;
+        EnumerateBoards(spot, 0, 0, player_ids, total);
+        return MakeResult(input, total, boards);
+    }
+
+    // One task per first dealt card; counts are integers so the merge order
+    // does not change the result.
+    std::vector<Tally> worker_tallies(pool_.GetThreadCount());
+    const auto last_first_card = spot.remaining.size() - missing;
+    for (std::size_t first = 0; first <= last_first_card; ++first) {
+        pool_.Submit([&spot, &worker_tallies, first](std::size_t worker_index) {
+            auto player_ids = spot.player_ids;
+            const auto id = Translator::FromCustomCardToPhevaluatorId(spot.remaining[first]);
+            for (std::size_t p = 0; p < spot.players_count; ++p) {
+                player_ids[p][2 + spot.known_board_count] = id;
+            }
+            EnumerateBoards(spot, 1, first + 1, player_ids, worker_tallies[worker_index]);
+        });
+    }
+    pool_.Wait();
+
+    for (const auto& tally : worker_tallies) total.Merge(tally);
+    return MakeResult(input, total, boards);
+}
+
+EquityResult EquityCalculator::RunMonteCarlo(const EquityInput& input, std::uint64_t trials, std::uint64_t seed) {
+    const auto spot = PrepareSpot(input);
+
+    std::vector<Tally> worker_tallies(pool_.GetThreadCount());
+    const std::uint64_t chunks = (trials + kChunkSize - 1) / kChunkSize;
+    for (std::uint64_t chunk = 0; chunk < chunks; ++chunk) {
+        const auto chunk_trials = std::min(kChunkSize, trials - chunk * kChunkSize);
+        pool_.Submit([&spot, &worker_tallies, seed, chunk, chunk_trials](std::size_t worker_index) {
+            auto rng = MakeChunkRng(seed, chunk);
+            RunMonteCarloChunk(spot, chunk_trials, rng, worker_tallies[worker_index]);
+        });
+    }
+    pool_.Wait();
+
+    Tally total;
+    for (const auto& tally : worker_tallies) total.Merge(tally);
+    return MakeResult(input, total, trials);
+}
+
+EquityResult EquityCalculator::RunMonteCarloInline(
+    const EquityInput& input, std::uint64_t trials, std::uint64_t seed) {
+    const auto spot = PrepareSpot(input);
+
+    Tally total;
+    const std::uint64_t chunks = (trials + kChunkSize - 1) / kChunkSize;
+    for (std::uint64_t chunk = 0; chunk < chunks; ++chunk) {
+        const auto chunk_trials = std::min(kChunkSize, trials - chunk * kChunkSize);
+        auto rng = MakeChunkRng(seed, chunk);
+        RunMonteCarloChunk(spot, chunk_trials, rng, total);
+    }
+    return MakeResult(input, total, trials);
+}
@@ -0,0 +1,184 @@
+#include "equity/PreflopEquityTable.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <cstdlib>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+struct FileHeader {
+    std::array<char, 4> magic;
+    std::uint32_t version;
+    std::uint32_t classes;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 16);
+
+constexpr std::size_t kEntries = PreflopEquityTable::kHandClasses * PreflopEquityTable::kHandClasses;
+constexpr std::size_t kFileSize = sizeof(FileHeader) + kEntries * sizeof(std::uint16_t);
+constexpr double kScale = 65535.0;
+
+std::size_t RankIndex(const Card& card) noexcept {
+    return static_cast<std::size_t>(card.GetRank()) - static_cast<std::size_t>(ECardRank::TWO);
+}
+
+void ValidateHeader(const FileHeader& header, const std::string& path) {
+    if (header.magic != PreflopEquityTable::kMagic ||
+        header.version != PreflopEquityTable::kVersion ||
+        header.classes != PreflopEquityTable::kHandClasses) {
+        throw std::runtime_error("Invalid preflop equity table: " + path);
+    }
+}
+
+} // namespace
+
+PreflopEquityTable::~PreflopEquityTable() {
+    Release();
+}
+
+PreflopEquityTable::PreflopEquityTable(PreflopEquityTable&& other) noexcept
+    : equities_(std::exchange(other.equities_, nullptr))
+    , mapping_(std::exchange(other.mapping_, nullptr))
+    , mapping_size_(std::exchange(other.mapping_size_, 0)) {}
+
+PreflopEquityTable& PreflopEquityTable::operator=(PreflopEquityTable&& other) noexcept {
+    if (this != &other) {
+        Release();
+        equities_ = std::exchange(other.equities_, nullptr);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mapping_size_ = std::exchange(other.mapping_size_, 0);
+    }
+    return *this;
+}
+
+void PreflopEquityTable::Release() noexcept {
+    if (!mapping_) return;
+#if defined(_WIN32)
+    std::free(mapping_);
+#else
+    ::munmap(mapping_, mapping_size_);
+#endif
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+    equities_ = nullptr;
+}
+
+PreflopEquityTable PreflopEquityTable::Load(const std::string& path) {
+    PreflopEquityTable table;
+
+#if defined(_WIN32)
+    // No mmap here: read the whole (small) file into one buffer instead.
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("Cannot open preflop equity table: " + path);
+    table.mapping_ = std::malloc(kFileSize);
+    table.mapping_size_ = kFileSize;
+    if (!table.mapping_ || !file.read(static_cast<char*>(table.mapping_), kFileSize)) {
+        throw std::runtime_error("Cannot read preflop equity table: " + path);
+    }
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Cannot open preflop equity table: " + path);
+
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) != kFileSize) {
+        ::close(fd);
+        throw std::runtime_error("Unexpected preflop equity table size: " + path);
+    }
+
+    void* mapping = ::mmap(nullptr, kFileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) throw std::runtime_error("Cannot map preflop equity table: " + path);
+
+    table.mapping_ = mapping;
+    table.mapping_size_ = kFileSize;
+#endif
+
+    FileHeader header {};
+    std::memcpy(&header, table.mapping_, sizeof(header));
+    ValidateHeader(header, path);
+
+    table.equities_ = reinterpret_cast<const std::uint16_t*>(
+        static_cast<const char*>(table.mapping_) + sizeof(FileHeader));
+    return table;
+}
+
+void PreflopEquityTable::Write(const std::string& path, std::span<const double> equities) {
+    if (equities.size() != kEntries) {
+        throw std::invalid_argument("Preflop equity table needs 169 * 169 values");
+    }
+
+    std::vector<std::uint16_t> scaled(kEntries);
+    std::transform(equities.begin(), equities.end(), scaled.begin(), [](double equity) {
+        return static_cast<std::uint16_t>(std::lround(std::clamp(equity, 0.0, 1.0) * kScale));
+    });
+
+    const FileHeader header {kMagic, kVersion, static_cast<std::uint32_t>(kHandClasses), 0};
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(scaled.data()), scaled.size() * sizeof(std::uint16_t));
+    if (!file) throw std::runtime_error("Cannot write preflop equity table: " + path);
+}
+
+std::size_t PreflopEquityTable::GetHandClass(const PlayerSession::Hand_t& hand) noexcept {
+    const auto a = RankIndex(hand[0]);
+    const auto b = RankIndex(hand[1]);
+    const auto high = std::max(a, b);
+    const auto low = std::min(a, b);
+
+    if (high == low) return high * kRanks + high;
+    if (hand[0].GetSuit() == hand[1].GetSuit()) return high * kRanks + low;
+    return low * kRanks + high;
+}
+
+PreflopEquityTable::Combos_t PreflopEquityTable::GetClassCombos(std::size_t hand_class) noexcept {
+    assert(hand_class < kHandClasses);
+
+    constexpr std::array<ECardSuit, 4> kSuits {
+        ECardSuit::CLUBS, ECardSuit::DIAMONDS, ECardSuit::HEARTS, ECardSuit::SPADES
+    };
+    const auto row = hand_class / kRanks;
+    const auto col = hand_class % kRanks;
+    const auto high = static_cast<ECardRank>(std::max(row, col) + static_cast<std::size_t>(ECardRank::TWO));
+    const auto low = static_cast<ECardRank>(std::min(row, col) + static_cast<std::size_t>(ECardRank::TWO));
+
+    Combos_t combos;
+    for (std::size_t s1 = 0; s1 < kSuits.size(); ++s1) {
+        for (std::size_t s2 = 0; s2 < kSuits.size(); ++s2) {
+            const bool keep = (row == col) ? (s1 < s2)
+                            : (row > col)  ? (s1 == s2)
+                                           : (s1 != s2);
+            if (keep) combos.push_back({{{kSuits[s1], high}, {kSuits[s2], low}}});
+        }
+    }
+    return combos;
+}
+
+bool PreflopEquityTable::IsLoaded() const noexcept {
+    return equities_ != nullptr;
+}
+
+double PreflopEquityTable::GetClassEquity(std::size_t hero_class, std::size_t villain_class) const noexcept {
+    assert(IsLoaded());
+    return static_cast<double>(equities_[hero_class * kHandClasses + villain_class]) / kScale;
+}
+
+double PreflopEquityTable::GetEquity(
+    const PlayerSession::Hand_t& hero, const PlayerSession::Hand_t& villain) const noexcept {
+    return GetClassEquity(GetHandClass(hero), GetHandClass(villain));
+}
@@ -4,23 +4,29 @@
 
 #include "utils/Translator.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
 
 #include <cassert>
 #include <algorithm>
+#include <array>
+#include <limits>
 #include <stdexcept>
 #include <ranges>
 
-#include <set>
-
-GameLogic::GameLogic(IDeck& deck, ITable& table, PlayerList& player_list) 
+template <DeckType TDeck, TableType TTable>
+BasicGameLogic<TDeck, TTable>::BasicGameLogic(TDeck& deck, TTable& table, PlayerList& player_list)
     : deck_(deck)
     , table_(table)
     , player_list_(player_list) {
-    dealer_index_ = *player_list_.LastOccupiedSeat();
+    // Players may also sit down later; see SetDealerIndex.
+    dealer_index_ = player_list_.LastOccupiedSeat().value_or(0);
 }
 
-void GameLogic::StartHand() {
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::StartHand() {
+    POKER_TRACE_SCOPE("GameLogic::StartHand");
     table_.ResetPots();
+    table_.ClearCommunityCards();
 
     dealer_index_ = *player_list_.NextOccupiedSeat(dealer_index_);
     index_blind_small_ = *player_list_.NextOccupiedSeat(dealer_index_);
@@ -28,9 +34,10 @@ void GameLogic::StartHand() {
 
     deck_.Shuffle();
 
-    for (auto& seat_idx : player_list_.GetActiveSeatIndices()) {
-        auto& session = player_list_.GetSession(seat_idx);
-        session.NewHand();
+    // Every seated player is dealt in, including those who folded last hand.
+    player_list_.NewHand();
+    for (const auto seat_idx : player_list_.GetOccupiedMask()) {
+        auto session = player_list_.GetSession(seat_idx);
         for (std::size_t i = 0; i < 2; ++i) {
             auto maybe_card = deck_.Draw();
             if (!maybe_card) {
@@ -48,46 +55,74 @@ void GameLogic::StartHand() {
     PayToPot(index_blind_small_, sb);
     PayToPot(index_blind_big_, bb);
 
+    // The big blind is the opening bet: a raise must add at least that much.
     highest_bet_ = bb;
-    last_raise_ = 0.0;
-    current_player_index_ = *player_list_.NextOccupiedSeat(index_blind_big_);
+    last_raise_ = bb;
 
     state_ = ELogicState::PREFLOP;
-    round_finished_ = false;
-    did_someone_bet_ = false;
+    BeginBettingRound(index_blind_big_);
 }
 
-void GameLogic::PayToPot(std::size_t player_idx, Coins_t amount) {
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::PayToPot(std::size_t player_idx, Coins_t amount) {
     table_.ContributeToPot(player_idx, amount);
     
-    auto& player = player_list_.GetPlayer(player_idx);
+    auto player = player_list_.GetPlayer(player_idx);
     player.SetStack(player.GetStack() - amount);
 
-    const bool is_all_in = (player.GetStack() == 0.0);
-    player_list_.GetSession(player_idx).SetAllIn(is_all_in);
+    auto session = player_list_.GetSession(player_idx);
+    session.SetTotalBet(session.GetTotalBet() + amount);
+
+    const bool is_all_in = (player.GetStack() == 0);
+    player_list_.SetAllIn(player_idx, is_all_in);
 
-    Logger::Debug("#### #### Player {} #### #### ", player_idx);
-    Logger::Debug("# Betting: {}", amount);
-    Logger::Debug("# Player Stack: {}", player.GetStack());
-    Logger::Debug("#### #### #### #### #### ####");
+    POKER_LOG_DEBUG("Player {} bets {}, stack {}", player_idx, amount, player.GetStack());
 }
 
-void GameLogic::ProcessPlayerAction(const Action& action) {
-    auto& player_seat = player_list_.GetSeat(current_player_index_);
-    auto& player_session = player_seat.session;
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::ProcessPlayerAction(const Action& action) {
+    POKER_TRACE_SCOPE("GameLogic::ProcessPlayerAction");
+    auto player_session = player_list_.GetSession(current_player_index_);
+
+    if (action.amount > highest_bet_) {
+        // Checked before anything moves so a rejected action changes nothing.
+        if (!CanRaise()) {
+            throw std::invalid_argument("Seat may only call or fold after a short all-in");
+        }
+        const Coins_t all_in = player_session.GetLastBet()
+            + player_list_.GetPlayer(current_player_index_).GetStack();
+        if (action.amount < GetMinRaise() && action.amount < all_in) {
+            throw std::invalid_argument("Raise is below the minimum raise");
+        }
+    }
 
-    if (action.amount > 0.0) {
+    if (action.amount > 0) {
         // TODO: move player stack to session
-        did_someone_bet_ = true; // we need this?
         PayToPot(current_player_index_, action.amount - player_session.GetLastBet());
         player_session.SetLastBet(action.amount);
-        highest_bet_ = action.amount;
+        // A short all-in call must not lower the bet everybody else faces.
+        if (action.amount > highest_bet_) {
+            // Every other seat that can still bet is now behind and owes an
+            // action. Only a full raise reopens the betting: it sets the
+            // minimum for the next raise. After a short all-in the seats that
+            // already acted may call or fold, but not raise again.
+            const SeatMask can_bet = player_list_.GetActiveMask() - player_list_.GetAllInMask();
+            const Coins_t raise = action.amount - highest_bet_;
+            if (raise >= last_raise_) {
+                last_raise_ = raise;
+                raise_closed_ = SeatMask{};
+            } else {
+                raise_closed_ = raise_closed_ | (can_bet - to_act_);
+            }
+            to_act_ = can_bet;
+            highest_bet_ = action.amount;
+        }
     } else {
         // fold / check
         if (action.action == EPlayerAction::FOLD) {
             table_.RemovePlayerFromCurrentPot(current_player_index_);
             player_session.ClearHand();
-            player_session.SetFold(true);
+            player_list_.SetFold(current_player_index_, true);
             if (player_list_.CountActiveSeats() == 1) { // TODO: move this to method
                 HandleShowdown();
                 return;
@@ -95,90 +130,42 @@ void GameLogic::ProcessPlayerAction(const Action& action) {
         }
     }
 
+    to_act_.Erase(current_player_index_);
     AdvanceTurn();
 }
 
-void GameLogic::AdvanceTurn() {
-    // TODO: Refactor project later.
-    current_player_index_ = *player_list_.NextActiveSeat(current_player_index_);
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::AdvanceTurn() {
+    // All-in seats are never in to_act_, so they are skipped.
+    current_player_index_ = to_act_.NextAfter(current_player_index_)
+        .value_or(*player_list_.NextActiveSeat(current_player_index_));
     round_finished_ = IsBettingRoundComplete();
     
     if (round_finished_) {
-        // TODO: Fix this.
-        // TODO: If someone went all in.
-            // 0 players has more chips to play. => HandleShowDonw()?
-            // 1 player has more chips to play. => Fix that last bet. Subtract from pot that already putted in. 
-            // N player has more chips to play. => Add 1 pot, keep playing.
-        
         const auto active_players = player_list_.GetActiveSeatIndices();
-        std::size_t count_all_in_players = player_list_.CountAllInPlayers();
-
-        // If everyone is all-in. 
-        //      Split in pots. (There can be pots of 1). Do not clear pots, just add new ones.
-        // Elseif all - 1.
-        //      Split in pots.
-        // Else (all-N-1 or more).
-        //      Keep playing.
+        const std::size_t count_all_in_players = player_list_.CountAllInPlayers();
 
-        if (count_all_in_players >= active_players.size() - 1) {
-            ComputePotsAmount();
+        if (count_all_in_players + 1 >= active_players.size()) {
+            // At most one player can still bet: nothing left to decide.
             HandleShowdown();
-        } else if (count_all_in_players == 0) {
-           // Nothing?
-        } else {
-            // Fix overbet players.
-            highest_bet_ = player_list_.GetMinLastBet();;
-            for (const auto i : active_players) {
-                auto& player = player_list_.GetPlayer(i);
-                auto& session = player_list_.GetSession(i);
-                const auto last_bet = session.GetLastBet();
-                if (last_bet > highest_bet_) {
-                    const Coins_t overbet = last_bet - highest_bet_;
-                    session.SetLastBet(highest_bet_);
-                    table_.ExtractFromPot(overbet);
-                    player.IncreaseStack(overbet);
-                }
-            }
-
-            // Add one pot. Keep playing there.
-            table_.AddPot(0.0);
-        } 
+        } else if (count_all_in_players > 0) {
+            // Split what is in so far into main / side pots. An uncalled
+            // overbet ends up as a side pot only its owner can win.
+            ComputePotsAmount();
+        }
     }
 }
 
-void GameLogic::ComputePotsAmount() {
-    // TODO: Fix this method.
-    // Last pot is broken. Fix and continue.
-    std::vector<Pot> pots_without_last;
-    auto pots = table_.GetPots();
-    if (pots.size() > 1) {
-        pots_without_last = std::vector<Pot>(pots.begin(), pots.end() - 1);
-    }
-
-    table_.ResetPots();
-
-    std::set<Coins_t> pot_amounts {};
-    const auto active_player_indices = player_list_.GetActiveSeatIndices();
-    for (const auto i : active_player_indices) {
-        const auto& session = player_list_.GetSession(i);
-        if (!session.IsAllIn()) continue;
-
-        pot_amounts.emplace(session.GetLastBet());
-    }
-
-    for (const auto current_amount : pot_amounts) {
-        auto& pot = table_.AddPot(current_amount);
-        
-        for (const auto i : active_player_indices) {
-            const auto& player_session = player_list_.GetSession(i);
-            if (player_session.GetLastBet() >= current_amount) {
-                pot.players.insert(i);
-            }
-        }
-    }
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::ComputePotsAmount() {
+    // Rebuilt from every seat's chips for the whole hand, so it does not
+    // matter in which round the all-ins happened.
+    table_.BuildPots(player_list_.GetTotalBets(), player_list_.GetActiveMask());
 }
 
-void GameLogic::AdvanceState() {
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::AdvanceState() {
+    POKER_TRACE_SCOPE("GameLogic::AdvanceState");
     if (!round_finished_) {
         throw std::runtime_error("Round not finished yet");
     }
@@ -193,31 +180,45 @@ void GameLogic::AdvanceState() {
     }
 }
 
-void GameLogic::DealFlop() {
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::DealFlop() {
+    POKER_TRACE_SCOPE("GameLogic::DealFlop");
     state_ = ELogicState::FLOP;
     ResetBets();
     DrawCommunityCards(3);
-    current_player_index_ = *player_list_.NextActiveSeat(dealer_index_);
-    round_finished_ = false;
+    BeginBettingRound(dealer_index_);
 }
 
-void GameLogic::DealTurn() {
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::DealTurn() {
+    POKER_TRACE_SCOPE("GameLogic::DealTurn");
     state_ = ELogicState::TURN;
     ResetBets();
     DrawCommunityCards(1);
-    current_player_index_ = *player_list_.NextActiveSeat(dealer_index_);
-    round_finished_ = false;
+    BeginBettingRound(dealer_index_);
 }
 
-void GameLogic::DealRiver() {
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::DealRiver() {
+    POKER_TRACE_SCOPE("GameLogic::DealRiver");
     state_ = ELogicState::RIVER;
     ResetBets();
     DrawCommunityCards(1);
-    current_player_index_ = *player_list_.NextActiveSeat(dealer_index_);
-    round_finished_ = false;
+    BeginBettingRound(dealer_index_);
 }
 
-void GameLogic::DrawCommunityCards(std::size_t quantity) {
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::BeginBettingRound(std::size_t from) {
+    // Every seat that can still bet owes an action; the first is left of `from`.
+    to_act_ = player_list_.GetActiveMask() - player_list_.GetAllInMask();
+    raise_closed_ = SeatMask{};
+    current_player_index_ = to_act_.NextAfter(from)
+        .value_or(*player_list_.NextActiveSeat(from));
+    round_finished_ = to_act_.Empty();
+}
+
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::DrawCommunityCards(std::size_t quantity) {
     for (std::size_t i = 0; i < quantity; ++i) {
         auto maybe_card = deck_.Draw();
         if (!maybe_card) {
@@ -227,8 +228,11 @@ void GameLogic::DrawCommunityCards(std::size_t quantity) {
     }
 }
 
-void GameLogic::HandleShowdown() {
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::HandleShowdown() {
+    POKER_TRACE_SCOPE("GameLogic::HandleShowdown");
     state_ = ELogicState::SHOWDOWN;
+    ComputePotsAmount();
 
     // On Showdown should be always 5 cards. Even if coming from a preflop all-in.
     const auto community_cards_count = table_.GetCommunityCards().size();
@@ -240,55 +244,177 @@ void GameLogic::HandleShowdown() {
     round_finished_ = true;
 }
 
-void GameLogic::ComputePlayersRank() {
-    auto& pots = table_.GetPots();
-    for (auto& pot : pots) {
-        for (auto& player_idx : pot.players) {
-            const auto rank = Translator::RankFromPlayerTableCards(
-                player_list_.GetSession(player_idx).GetHand(),
-                table_.GetCommunityCards());
-            
-            player_list_.GetSession(player_idx).SetRank(rank);
-        }
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::ComputePlayersRank() {
+    POKER_TRACE_SCOPE("GameLogic::ComputePlayersRank");
+    // A seat in several pots is evaluated once.
+    SeatMask contenders;
+    for (const auto& pot : table_.GetPots()) {
+        contenders |= pot.players;
+    }
+
+    for (const auto player_idx : contenders) {
+        const auto rank = Translator::RankFromPlayerTableCards(
+            player_list_.GetSession(player_idx).GetHand(),
+            table_.GetCommunityCards());
+        
+        player_list_.GetSession(player_idx).SetRank(rank);
     }
 }
 
-void GameLogic::FinishHand() {
-    // if (state_ !=) throw std::runtime_error("No winner found!");
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::FinishHand() {
+    POKER_TRACE_SCOPE("GameLogic::FinishHand");
+    if (state_ != ELogicState::SHOWDOWN) {
+        throw std::runtime_error("Hand can only finish after the showdown");
+    }
 
-    // TODO: Implement.
-        // 1. Compare ranks and seek for tie.
-        // 2. Give prizes. If there's a tie. Divide the amount between players.
-        // 2. Reset pot.
+    for (const auto& pot : table_.GetPots()) {
+        PayPot(pot);
+    }
+    table_.ResetPots();
 
     state_ = ELogicState::HAND_FINISHED;
 }
 
-void GameLogic::ResetBets() {
-    highest_bet_ = 0.0;
-    last_raise_ = 0.0;
-    for (auto& p : player_list_) {
-        p.session.SetLastBet(0.0);
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::PayPot(const Pot& pot) {
+    if (pot.amount <= 0 || pot.players.Empty()) return;
+
+    // phevaluator ranks go from 1 (royal flush) upwards, so the best hand is
+    // the minimum. Both passes run over every seat with no data-dependent
+    // branches; seats outside the pot read as "worse than anything".
+    constexpr int kNoHand = std::numeric_limits<int>::max();
+    const auto& ranks = player_list_.GetRanks();
+    std::array<int, PlayerList::kMaxPlayers> values{};
+    int best = kNoHand;
+    for (std::size_t i = 0; i < PlayerList::kMaxPlayers; ++i) {
+        values[i] = pot.players.Contains(i) ? ranks[i].value() : kNoHand;
+        best = std::min(best, values[i]);
+    }
+
+    SeatMask::Mask_t winners_bits = 0;
+    for (std::size_t i = 0; i < PlayerList::kMaxPlayers; ++i) {
+        winners_bits |= static_cast<SeatMask::Mask_t>((values[i] == best) << i);
+    }
+    const SeatMask winners(winners_bits);
+
+    const auto count = static_cast<Coins_t>(winners.Count());
+    const Coins_t share = pot.amount / count;
+    for (const auto seat : winners) {
+        player_list_.GetPlayer(seat).IncreaseStack(share);
+    }
+
+    // Odd chips go one at a time to the winners closest to the button's left.
+    auto seat = dealer_index_;
+    for (Coins_t odd = pot.amount % count; odd > 0; --odd) {
+        seat = *winners.NextAfter(seat);
+        player_list_.GetPlayer(seat).IncreaseStack(1);
     }
 }
 
-bool GameLogic::IsBettingRoundComplete() const {
-    return std::all_of(player_list_.begin(), player_list_.end(), [&](const auto& seat) {
-        return (!seat.player || 
-                seat.session.IsFold() ||
-                seat.session.IsAllIn() ||
-                (did_someone_bet_ && seat.session.GetLastBet() == highest_bet_));
-    });
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::ResetBets() {
+    highest_bet_ = 0;
+    // The opening bet of a round must be at least the big blind.
+    last_raise_ = table_.GetBlindBig();
+    player_list_.ClearLastBets();
 }
 
-ELogicState GameLogic::GetState() const noexcept {
+template <DeckType TDeck, TableType TTable>
+bool BasicGameLogic<TDeck, TTable>::IsBettingRoundComplete() const noexcept {
+    // to_act_ is kept up to date by every action, so this is one mask test.
+    return to_act_.Empty();
+}
+
+template <DeckType TDeck, TableType TTable>
+ELogicState BasicGameLogic<TDeck, TTable>::GetState() const noexcept {
     return state_;
 }
 
-std::size_t GameLogic::GetDealerIndex() const noexcept {
+template <DeckType TDeck, TableType TTable>
+bool BasicGameLogic<TDeck, TTable>::IsRoundFinished() const noexcept {
+    return round_finished_;
+}
+
+template <DeckType TDeck, TableType TTable>
+std::size_t BasicGameLogic<TDeck, TTable>::GetDealerIndex() const noexcept {
     return dealer_index_;
 }
 
-std::size_t GameLogic::GetCurrentPlayerIndex() const noexcept {
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::SetDealerIndex(std::size_t seat_index) {
+    if (seat_index >= PlayerList::kMaxPlayers) {
+        throw std::out_of_range("Dealer seat out of range");
+    }
+    dealer_index_ = seat_index;
+}
+
+template <DeckType TDeck, TableType TTable>
+std::size_t BasicGameLogic<TDeck, TTable>::GetCurrentPlayerIndex() const noexcept {
     return current_player_index_;
 }
+
+template <DeckType TDeck, TableType TTable>
+Coins_t BasicGameLogic<TDeck, TTable>::GetHighestBet() const noexcept {
+    return highest_bet_;
+}
+
+template <DeckType TDeck, TableType TTable>
+Coins_t BasicGameLogic<TDeck, TTable>::GetMinRaise() const noexcept {
+    return highest_bet_ + last_raise_;
+}
+
+template <DeckType TDeck, TableType TTable>
+bool BasicGameLogic<TDeck, TTable>::CanRaise() const noexcept {
+    return !raise_closed_.Contains(current_player_index_);
+}
+
+template <DeckType TDeck, TableType TTable>
+GameState BasicGameLogic<TDeck, TTable>::SaveState() const {
+    GameState state;
+    state.deck = deck_.SaveState();
+    state.table = table_.SaveState();
+    state.players = player_list_.SaveState();
+
+    auto& logic = state.logic;
+    logic.state = state_;
+    logic.round_finished = round_finished_;
+    logic.to_act = to_act_.GetMask();
+    logic.raise_closed = raise_closed_.GetMask();
+    logic.dealer_index = static_cast<std::uint8_t>(dealer_index_);
+    logic.index_blind_small = static_cast<std::uint8_t>(index_blind_small_);
+    logic.index_blind_big = static_cast<std::uint8_t>(index_blind_big_);
+    logic.current_player_index = static_cast<std::uint8_t>(current_player_index_);
+    logic.highest_bet = highest_bet_;
+    logic.last_raise = last_raise_;
+    return state;
+}
+
+template <DeckType TDeck, TableType TTable>
+void BasicGameLogic<TDeck, TTable>::RestoreState(const GameState& state) {
+    // Reject the snapshot before anything changes: the deck check is up
+    // front and the seats throw before they restore anything.
+    if (!state.deck.CanRestore()) {
+        throw std::invalid_argument("Saved deck cannot be restored without its random state");
+    }
+    player_list_.RestoreState(state.players);
+    [[maybe_unused]] const bool deck_restored = deck_.RestoreState(state.deck);
+    assert(deck_restored);
+    table_.RestoreState(state.table);
+
+    const auto& logic = state.logic;
+    state_ = logic.state;
+    round_finished_ = logic.round_finished;
+    to_act_ = SeatMask(logic.to_act);
+    raise_closed_ = SeatMask(logic.raise_closed);
+    dealer_index_ = logic.dealer_index;
+    index_blind_small_ = logic.index_blind_small;
+    index_blind_big_ = logic.index_blind_big;
+    current_player_index_ = logic.current_player_index;
+    highest_bet_ = logic.highest_bet;
+    last_raise_ = logic.last_raise;
+}
+
+template class BasicGameLogic<IDeck, ITable>;
+template class BasicGameLogic<Deck, Table>;
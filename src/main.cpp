@@ -1,5 +1,6 @@
 
 #include "Config.hpp"
+#include "GraphicsConfig.hpp"
 #include "Game.hpp"
 
 int main() {
@@ -0,0 +1,79 @@
+#include "sim/Agents.hpp"
+
+#include "utils/random/Bounded.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+Action MakeLegalAction(EPlayerAction intent, const AgentView& view) noexcept {
+    const Coins_t all_in = view.last_bet + view.stack;
+    const Coins_t to_call = view.GetToCall();
+
+    // Nothing left to put in: the only move is to pass the turn.
+    if (view.stack <= 0) return {EPlayerAction::CHECK};
+    // Behind a short all-in the seat may only call or fold.
+    if (!view.can_raise && intent != EPlayerAction::FOLD) intent = EPlayerAction::CALL;
+
+    switch (intent) {
+        case EPlayerAction::FOLD:
+            if (to_call > 0) return {EPlayerAction::FOLD};
+            return {EPlayerAction::CHECK};
+
+        case EPlayerAction::CHECK:
+        case EPlayerAction::CALL:
+            if (to_call <= 0) return {EPlayerAction::CHECK};
+            if (view.highest_bet >= all_in) return {EPlayerAction::ALL_IN, all_in};
+            return {EPlayerAction::CALL, view.highest_bet};
+
+        case EPlayerAction::BET:
+        case EPlayerAction::RAISE: {
+            const Coins_t target = std::max({view.highest_bet * 2, view.big_blind, view.min_raise});
+            if (target >= all_in) return {EPlayerAction::ALL_IN, all_in};
+            return {(view.highest_bet > 0) ? EPlayerAction::RAISE : EPlayerAction::BET, target};
+        }
+
+        case EPlayerAction::ALL_IN:
+            return {EPlayerAction::ALL_IN, all_in};
+    }
+
+    return {EPlayerAction::CHECK};
+}
+
+Action CallingAgent::Decide(const AgentView& view) {
+    return MakeLegalAction(EPlayerAction::CALL, view);
+}
+
+RandomAgent::RandomAgent(std::uint64_t seed)
+    : rng_(seed) {}
+
+Action RandomAgent::Decide(const AgentView& view) {
+    // Out of 100: fold 20, call 55, raise 22, all-in 3.
+    const auto value = UniformBelow(rng_, 100);
+
+    EPlayerAction intent = EPlayerAction::ALL_IN;
+    if (value < 20)      intent = EPlayerAction::FOLD;
+    else if (value < 75) intent = EPlayerAction::CALL;
+    else if (value < 97) intent = EPlayerAction::RAISE;
+
+    return MakeLegalAction(intent, view);
+}
+
+void RandomAgent::NewHand(std::uint64_t seed) {
+    rng_.Seed(seed);
+}
+
+ScriptedAgent::ScriptedAgent(std::vector<EPlayerAction> script)
+    : script_(std::move(script)) {
+    assert(!script_.empty() && "ScriptedAgent needs at least one action");
+}
+
+Action ScriptedAgent::Decide(const AgentView& view) {
+    const auto intent = script_[next_];
+    next_ = (next_ + 1) % script_.size();
+    return MakeLegalAction(intent, view);
+}
+
+void ScriptedAgent::NewHand(std::uint64_t /*seed*/) {
+    next_ = 0;
+}
@@ -0,0 +1,164 @@
+#include "sim/HandSimulator.hpp"
+
+#include "sim/Agents.hpp"
+
+#include "utils/Trace.hpp"
+#include "utils/random/SeedHierarchy.hpp"
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+std::unique_ptr<IAgent> MakeAgent(const SimulationConfig& config, std::size_t seat) {
+    switch (config.agent) {
+        case EAgentKind::CALLING:  return std::make_unique<CallingAgent>();
+        case EAgentKind::RANDOM:   return std::make_unique<RandomAgent>(DeriveSeed(config.seed, seat));
+        case EAgentKind::SCRIPTED: return std::make_unique<ScriptedAgent>(config.script);
+    }
+    throw std::invalid_argument("Unknown agent kind");
+}
+
+} // namespace
+
+void SimulationStats::Merge(const SimulationStats& other) noexcept {
+    hands += other.hands;
+    actions += other.actions;
+    showdowns += other.showdowns;
+    for (std::size_t i = 0; i < allocations.size(); ++i) {
+        allocations[i] += other.allocations[i];
+    }
+}
+
+void HandSimulator::Validate(const SimulationConfig& config) {
+    if (config.players < 2 || config.players > PlayerList::kMaxPlayers) {
+        throw std::invalid_argument("Simulation needs between 2 and 10 players");
+    }
+    if (config.agent == EAgentKind::SCRIPTED && config.script.empty()) {
+        throw std::invalid_argument("Scripted agents need a non-empty script");
+    }
+    if (config.starting_stack <= 0) {
+        throw std::invalid_argument("Starting stack must be positive");
+    }
+}
+
+HandSimulator::HandSimulator(const SimulationConfig& config)
+    : config_(config)
+    , rng_(config.seed)
+    , deck_(kCardDeck, rng_, EDeckMode::DEAL_ON_DEMAND)
+    , fresh_deck_(deck_.SaveState())
+    , table_(kBlindSmall, kBlindBig)
+    , logic_(deck_, table_, player_list_) {
+    Validate(config_);
+
+    for (std::size_t i = 0; i < config_.players; ++i) {
+        player_list_.SitPlayer(Player("P" + std::to_string(i), config_.starting_stack));
+    }
+    // The first hand's button goes to the first seat.
+    logic_.SetDealerIndex(*player_list_.LastOccupiedSeat());
+
+    agents_.reserve(config_.players);
+    for (std::size_t seat = 0; seat < config_.players; ++seat) {
+        agents_.push_back(MakeAgent(config_, seat));
+    }
+    // Hands are played on the constructing thread; its trace buffer must
+    // not be allocated inside the first measured call.
+    if (Tracer::kCompiledIn && Tracer::IsEnabled()) Tracer::RegisterThisThread();
+}
+
+SimulationStats HandSimulator::Run(std::uint64_t hands) {
+    SimulationStats stats;
+    for (std::uint64_t i = 0; i < hands; ++i) {
+        PlayHand(stats);
+    }
+    return stats;
+}
+
+void HandSimulator::PlayHand(SimulationStats& stats) {
+    PlayHandNumber(next_hand_++, stats);
+}
+
+void HandSimulator::ReplayHand(std::uint64_t hand, SimulationStats& stats) {
+    PlayHandNumber(hand, stats);
+}
+
+void HandSimulator::PlayHandNumber(std::uint64_t hand, SimulationStats& stats) {
+    const auto hand_seed = DeriveHandSeed(config_.seed, config_.table_id, hand);
+
+    // A deal-on-demand deck keeps the previous hand's order; start from the
+    // initial order so the deal depends on the hand seed alone. Restoring
+    // also rewinds rng_, so reseed after it.
+    [[maybe_unused]] const bool restored = deck_.RestoreState(fresh_deck_);
+    assert(restored && "XoshiroRandomProvider always saves its state");
+    rng_.Reseed(hand_seed);
+
+    for (const auto seat : player_list_.GetOccupiedSeatIndices()) {
+        player_list_.GetPlayer(seat).SetStack(config_.starting_stack);
+        agents_[seat]->NewHand(DeriveSeed(hand_seed, seat + 1));
+    }
+
+    // Seats 0..players-1 are occupied, so StartHand puts the button on seat hand % players.
+    const auto players = config_.players;
+    logic_.SetDealerIndex((hand % players + players - 1) % players);
+    Measure(stats, [this] { logic_.StartHand(); });
+
+    std::size_t actions = 0;
+    while (logic_.GetState() != ELogicState::HAND_FINISHED) {
+        if (logic_.IsRoundFinished()) {
+            if (logic_.GetState() == ELogicState::SHOWDOWN && player_list_.CountActiveSeats() > 1) {
+                ++stats.showdowns;
+            }
+            Measure(stats, [this] { logic_.AdvanceState(); });
+            continue;
+        }
+
+        if (++actions > kMaxActionsPerHand) {
+            throw std::runtime_error("Hand did not finish within the action limit");
+        }
+
+        const auto seat = logic_.GetCurrentPlayerIndex();
+        Measure(stats, [&] { logic_.ProcessPlayerAction(agents_[seat]->Decide(MakeView(seat))); });
+    }
+
+    stats.actions += actions;
+    ++stats.hands;
+}
+
+template <typename F>
+void HandSimulator::Measure(SimulationStats& stats, F&& call) {
+    const AllocationScope scope;
+    call();
+    stats.allocations[static_cast<std::size_t>(logic_.GetState())] += scope.Elapsed();
+}
+
+AgentView HandSimulator::MakeView(std::size_t seat) const {
+    const auto& session = player_list_.GetSession(seat);
+    return AgentView{
+        .seat = seat,
+        .state = logic_.GetState(),
+        .hand = session.GetHand(),
+        .stack = player_list_.GetPlayer(seat).GetStack(),
+        .last_bet = session.GetLastBet(),
+        .highest_bet = logic_.GetHighestBet(),
+        .big_blind = table_.GetBlindBig(),
+        .min_raise = logic_.GetMinRaise(),
+        .can_raise = logic_.CanRaise()
+    };
+}
+
+std::uint64_t HandSimulator::GetNextHand() const noexcept {
+    return next_hand_;
+}
+
+const PlayerList& HandSimulator::GetPlayerList() const noexcept {
+    return player_list_;
+}
+
+const Table& HandSimulator::GetTable() const noexcept {
+    return table_;
+}
+
+const DirectGameLogic& HandSimulator::GetGameLogic() const noexcept {
+    return logic_;
+}
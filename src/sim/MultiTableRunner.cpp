@@ -0,0 +1,44 @@
+#include "sim/MultiTableRunner.hpp"
+
+#include <vector>
+
+namespace {
+
+// One cache line per worker so the tallies never false-share.
+struct alignas(64) WorkerStats {
+    SimulationStats stats;
+};
+
+} // namespace
+
+MultiTableRunner::MultiTableRunner(std::size_t thread_count)
+    : pool_(thread_count) {}
+
+SimulationStats MultiTableRunner::Run(const SimulationConfig& table_config,
+                                      std::size_t tables,
+                                      std::uint64_t hands_per_table) {
+    std::vector<WorkerStats> per_worker(pool_.GetThreadCount());
+
+    for (std::size_t table = 0; table < tables; ++table) {
+        pool_.Submit([&, table](std::size_t worker_index) {
+            auto config = table_config;
+            config.table_id = table;
+
+            HandSimulator simulator(config);
+            for (std::uint64_t hand = 0; hand < hands_per_table; ++hand) {
+                simulator.PlayHand(per_worker[worker_index].stats);
+            }
+        });
+    }
+    pool_.Wait();
+
+    SimulationStats total;
+    for (const auto& worker : per_worker) {
+        total.Merge(worker.stats);
+    }
+    return total;
+}
+
+std::size_t MultiTableRunner::GetThreadCount() const noexcept {
+    return pool_.GetThreadCount();
+}
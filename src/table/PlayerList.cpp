@@ -1,169 +1,217 @@
 #include "table/PlayerList.hpp"
 
-#include <ranges>
 #include <algorithm>
+#include <cassert>
+#include <stdexcept>
 
 PlayerList::PlayerList() {
     ClearPlayers();
 }
 
 void PlayerList::ClearPlayers() {
-    for (std::size_t i = 0; i < seats_.size(); ++i) {
+    for (std::size_t i = 0; i < kMaxPlayers; ++i) {
         RemovePlayer(i);
     }
 }
 
 std::optional<std::size_t> PlayerList::SitPlayer(Player&& player) {
-    for (std::size_t i = 0; i < seats_.size(); ++i) {
-        if (seats_[i].player) continue;
-        
-        seats_[i].player = std::move(player);
-        seats_[i].session = {};
-        return i;
-    }
+    const auto seat = FindEmptySeat();
+    if (!seat) return std::nullopt;
 
-    return std::nullopt;
+    SitPlayerAt(std::move(player), *seat);
+    return seat;
 }
 
 bool PlayerList::SitPlayerAt(Player&& player, std::size_t seat_index) {
-    if (seat_index >= kMaxPlayers || seats_[seat_index].player) return false;
+    if (seat_index >= kMaxPlayers || occupied_.Contains(seat_index)) return false;
     
-    seats_[seat_index].player = std::move(player);
-    seats_[seat_index].session = {};
+    names_[seat_index] = player.GetName();
+    stacks_[seat_index] = player.GetStack();
+    ResetSeatSession(seat_index);
+    occupied_.Insert(seat_index);
     return true;
 }
 
 bool PlayerList::RemovePlayer(std::size_t seat_index) {
-    if (seat_index >= kMaxPlayers || !seats_[seat_index].player) return false;
+    if (seat_index >= kMaxPlayers || !occupied_.Contains(seat_index)) return false;
     
-    seats_[seat_index].player = std::nullopt;
-    seats_[seat_index].session = {};
+    names_[seat_index].clear();
+    stacks_[seat_index] = 0;
+    ResetSeatSession(seat_index);
+    occupied_.Erase(seat_index);
     return true;
 }
 
 std::optional<std::size_t> PlayerList::FindEmptySeat() const {
-    for (std::size_t i = 0; i < seats_.size(); ++i)
-        if (!seats_[i].player) return i;
-    return std::nullopt;
+    return (SeatMask::FirstN(kMaxPlayers) - occupied_).First();
 }
 
 std::optional<std::size_t> PlayerList::NextOccupiedSeat(std::size_t from) const {
-    std::size_t idx = from;
-    for (std::size_t i = 0; i < kMaxPlayers; ++i) {
-        idx = (idx + 1) % kMaxPlayers;
-        if (seats_[idx].player) return idx;
-    }
-    return std::nullopt;
+    return occupied_.NextAfter(from);
 }
 
 std::optional<std::size_t> PlayerList::NextActiveSeat(std::size_t from) const {
-    std::size_t idx = from;
-    for (std::size_t i = 0; i < kMaxPlayers; ++i) {
-        idx = (idx + 1) % kMaxPlayers;
-        if (seats_[idx].player && !seats_[idx].session.IsFold()) return idx;
-    }
-    return std::nullopt;
+    return GetActiveMask().NextAfter(from);
 }
 
 std::optional<std::size_t> PlayerList::NextEmptySeat(std::size_t from) const {
-    std::size_t idx = from;
-    for (std::size_t i = 0; i < kMaxPlayers; ++i) {
-        idx = (idx + 1) % kMaxPlayers;
-        if (!seats_[idx].player) return idx;
-    }
-    return std::nullopt;
+    return (SeatMask::FirstN(kMaxPlayers) - occupied_).NextAfter(from);
 }
 
 std::size_t PlayerList::CountAllInPlayers() const {
-    const auto active_seat_indices = GetActiveSeatIndices();
-    return std::count_if(active_seat_indices.begin(), active_seat_indices.end(), [&](const auto i) {
-        return (GetSession(i).IsAllIn());
-    });
-}
-
-Coins_t PlayerList::GetMinLastBet() const {
-    auto active_seat_indices  = GetActiveSeatIndices();
-    auto filtered_stacks = active_seat_indices 
-        | std::views::transform([&](const auto i) {
-            return GetPlayer(i).GetStack();
-        });
-
-    auto it = std::ranges::min_element(filtered_stacks);
-    return *it;
+    return (all_in_ & GetActiveMask()).Count();
 }
 
 std::optional<std::size_t> PlayerList::LastOccupiedSeat() const {
-    for (std::size_t i = kMaxPlayers; i > 0; --i) {
-        std::size_t idx = i - 1;
-        if (seats_[idx].player) {
-            return idx;
-        }
-    }
-    return std::nullopt;
+    return occupied_.Last();
 }
 
 std::optional<std::size_t> PlayerList::FindFirstActiveSeat() const {
-    
-    for (std::size_t i = 0; i < kMaxPlayers; ++i) {
-        if (seats_[i].player && !seats_[i].session.IsFold()) {
-            return i;
-        }
-    }
-    return std::nullopt;
+    return GetActiveMask().First();
 }
 
-std::vector<std::size_t> PlayerList::GetOccupiedSeatIndices() const {
-    std::vector<std::size_t> indices;
-    for (std::size_t i = 0; i < seats_.size(); ++i) {
-        if (seats_[i].player) indices.push_back(i);
-    }
-    return indices;
+PlayerList::SeatIndices_t PlayerList::GetOccupiedSeatIndices() const {
+    return occupied_;
 }
 
-std::vector<std::size_t> PlayerList::GetActiveSeatIndices() const {
-    std::vector<std::size_t> indices;
-    for (std::size_t i = 0; i < seats_.size(); ++i)
-        if (seats_[i].player && !seats_[i].session.IsFold()) indices.push_back(i);
-    return indices;
+PlayerList::SeatIndices_t PlayerList::GetActiveSeatIndices() const {
+    return GetActiveMask();
 }
 
 std::size_t PlayerList::CountOccupiedSeats() const {
-    return std::ranges::count_if(
-        seats_,
-        [&](const auto& s) { return (s.player.has_value()); });
+    return occupied_.Count();
 }
 
 std::size_t PlayerList::CountActiveSeats() const {
-    return std::ranges::count_if(
-        seats_,
-        [&](const auto& s) { return (s.player.has_value() && !s.session.IsFold()); });
+    return GetActiveMask().Count();
+}
+
+SeatMask PlayerList::GetOccupiedMask() const noexcept {
+    return occupied_;
+}
+
+SeatMask PlayerList::GetActiveMask() const noexcept {
+    return occupied_ - folded_;
+}
+
+SeatMask PlayerList::GetFoldedMask() const noexcept {
+    return folded_;
+}
+
+SeatMask PlayerList::GetAllInMask() const noexcept {
+    return all_in_;
+}
+
+const PlayerList::CoinColumn_t& PlayerList::GetStacks() const noexcept {
+    return stacks_;
 }
 
-Player& PlayerList::GetPlayer(std::size_t seat_index) {
-    return *seats_[seat_index].player;
+const PlayerList::CoinColumn_t& PlayerList::GetLastBets() const noexcept {
+    return last_bets_;
 }
 
-const Player& PlayerList::GetPlayer(std::size_t seat_index) const {
-    return *seats_[seat_index].player;
+const PlayerList::CoinColumn_t& PlayerList::GetTotalBets() const noexcept {
+    return total_bets_;
 }
 
-PlayerSession& PlayerList::GetSession(std::size_t seat_index) {
-    return seats_[seat_index].session;
+const PlayerList::RankColumn_t& PlayerList::GetRanks() const noexcept {
+    return ranks_;
 }
 
-const PlayerSession& PlayerList::GetSession(std::size_t seat_index) const {
-    return seats_[seat_index].session;
+void PlayerList::SetFold(std::size_t seat_index, bool fold) noexcept {
+    folded_.Set(seat_index, fold);
 }
 
-PlayerList::Seat& PlayerList::GetSeat(std::size_t seat_index) {
-    return seats_[seat_index];
+void PlayerList::SetAllIn(std::size_t seat_index, bool all_in) noexcept {
+    all_in_.Set(seat_index, all_in);
 }
-const PlayerList::Seat& PlayerList::GetSeat(std::size_t seat_index) const {
-    return seats_[seat_index];
+
+void PlayerList::NewHand() noexcept {
+    for (const auto seat : occupied_) {
+        ResetSeatSession(seat);
+    }
+}
+
+void PlayerList::ClearLastBets() noexcept {
+    last_bets_.fill(0);
+}
+
+PlayerList::PlayerRef PlayerList::GetPlayer(std::size_t seat_index) {
+    assert(occupied_.Contains(seat_index));
+    return {*this, seat_index};
+}
+
+PlayerList::ConstPlayerRef PlayerList::GetPlayer(std::size_t seat_index) const {
+    assert(occupied_.Contains(seat_index));
+    return {*this, seat_index};
+}
+
+PlayerList::SessionRef PlayerList::GetSession(std::size_t seat_index) {
+    assert(seat_index < kMaxPlayers);
+    return {*this, seat_index};
+}
+
+PlayerList::ConstSessionRef PlayerList::GetSession(std::size_t seat_index) const {
+    assert(seat_index < kMaxPlayers);
+    return {*this, seat_index};
 }
 
 void PlayerList::ResetSessions() {
-    for (auto& seat : seats_) {
-        seat.session = {};
+    for (std::size_t i = 0; i < kMaxPlayers; ++i) {
+        ResetSeatSession(i);
+    }
+}
+
+void PlayerList::ResetSeatSession(std::size_t seat_index) noexcept {
+    // The hand array keeps its old cards; cards_counts_ says none are dealt.
+    cards_counts_[seat_index] = 0;
+    hand_sets_[seat_index].Clear();
+    last_bets_[seat_index] = 0;
+    total_bets_[seat_index] = 0;
+    ranks_[seat_index] = 0;
+    folded_.Erase(seat_index);
+    all_in_.Erase(seat_index);
+}
+
+PlayerListState PlayerList::SaveState() const noexcept {
+    PlayerListState state;
+    for (std::size_t i = 0; i < kMaxPlayers; ++i) {
+        auto& saved = state.seats[i];
+        saved.occupied = occupied_.Contains(i);
+        saved.stack = stacks_[i];
+
+        auto& session = saved.session;
+        session.hand = hands_[i];
+        session.hand_set = hand_sets_[i];
+        session.cards_count = cards_counts_[i];
+        session.is_fold = folded_.Contains(i);
+        session.is_all_in = all_in_.Contains(i);
+        session.last_bet = last_bets_[i];
+        session.total_bet = total_bets_[i];
+        session.rank = ranks_[i];
+    }
+    return state;
+}
+
+void PlayerList::RestoreState(const PlayerListState& state) {
+    for (std::size_t i = 0; i < kMaxPlayers; ++i) {
+        if (state.seats[i].occupied != occupied_.Contains(i)) {
+            throw std::invalid_argument("Saved state has a different seating");
+        }
     }
-}
\ No newline at end of file
+
+    for (std::size_t i = 0; i < kMaxPlayers; ++i) {
+        const auto& saved = state.seats[i];
+        stacks_[i] = saved.occupied ? saved.stack : 0;
+
+        const auto& session = saved.session;
+        hands_[i] = session.hand;
+        hand_sets_[i] = session.hand_set;
+        cards_counts_[i] = static_cast<std::uint8_t>(session.cards_count);
+        folded_.Set(i, session.is_fold);
+        all_in_.Set(i, session.is_all_in);
+        last_bets_[i] = session.last_bet;
+        total_bets_[i] = session.total_bet;
+        ranks_[i] = session.rank;
+    }
+}
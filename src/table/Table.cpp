@@ -1,8 +1,12 @@
 #include "table/Table.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
 Table::Table(Coins_t blind_small, Coins_t blind_big) noexcept
-    : pot_(0.0), blind_small_(blind_small), blind_big_(blind_big) {
-    pots_.emplace_back(0.0);
+    : pot_(0), blind_small_(blind_small), blind_big_(blind_big) {
+    pots_.emplace_back(0);
 }
 
 void Table::SetBlindSmall(Coins_t cost) noexcept {
@@ -23,17 +27,15 @@ void Table::IncreasePot(Coins_t value) noexcept {
 
 }
 
-void Table::ExtractFromPot(Coins_t amount) {
-    pots_[current_pot_idx_].amount -= amount;
-}
-
-void Table::ContributeToPot(std::size_t player_idx, Coins_t amount) {
-    pots_[current_pot_idx_].amount += amount;
-    pots_[current_pot_idx_].players.insert(player_idx);
-}
-
 void Table::AddCommunityCard(Card card) noexcept {
+    assert(!community_set_.Contains(card) && "Card already on the board");
     community_cards_.push_back(card);
+    community_set_.Insert(card);
+}
+
+void Table::ClearCommunityCards() noexcept {
+    community_cards_.clear();
+    community_set_.Clear();
 }
 
 Coins_t Table::GetPot() const noexcept {
@@ -52,13 +54,18 @@ const ITable::CommunityCards_t& Table::GetCommunityCards() const noexcept {
     return community_cards_;
 }
 
+CardSet Table::GetCommunityCardSet() const noexcept {
+    return community_set_;
+}
+
 void Table::ResetPots() {
     pots_.clear();
-    pots_.emplace_back(0.0);
+    pots_.emplace_back(0);
+    current_pot_idx_ = 0;
 }
 
 void Table::RemovePlayerFromCurrentPot(std::size_t player_idx) {
-    pots_[current_pot_idx_].players.erase(player_idx);
+    pots_[current_pot_idx_].players.Erase(player_idx);
 }
 
 const ITable::Pots_t& Table::GetPots() const noexcept {
@@ -66,7 +73,7 @@ const ITable::Pots_t& Table::GetPots() const noexcept {
 }
 
 void Table::AddPlayerToPot(std::size_t player_idx, std::size_t pot_idx) {
-    pots_[pot_idx].players.insert(player_idx);
+    pots_[pot_idx].players.Insert(player_idx);
 }
 
 Pot& Table::AddPot(Coins_t amount) {
@@ -77,3 +84,83 @@ Pot& Table::AddPot(Coins_t amount) {
 Pot& Table::GetPot(std::size_t pot_idx) {
     return pots_[pot_idx];
 }
+
+void Table::BuildPots(std::span<const Coins_t> contributions, SeatMask contenders) {
+    assert(contributions.size() <= SeatMask::kMaxSeats);
+
+    // Seats that put chips in, by contribution. At most 10, sorted once.
+    StaticVector<std::uint8_t, SeatMask::kMaxSeats> order;
+    SeatMask remaining; // Contenders not yet below the level reached.
+    for (std::size_t seat = 0; seat < contributions.size(); ++seat) {
+        if (contributions[seat] <= 0) continue;
+        order.push_back(static_cast<std::uint8_t>(seat));
+        if (contenders.Contains(seat)) remaining.Insert(seat);
+    }
+    std::sort(order.begin(), order.end(), [&](const auto lhs, const auto rhs) {
+        return contributions[lhs] < contributions[rhs];
+    });
+
+    // Each distinct contender contribution closes a pot: every seat from
+    // there up the order paid (amount - level) into it, plus whatever
+    // non-contenders paid between the two levels.
+    pots_.clear();
+    Coins_t level = 0;
+    Coins_t dead = 0;
+    for (std::size_t k = 0; k < order.size(); ++k) {
+        const auto seat = order[k];
+        const auto amount = contributions[seat];
+        const bool contender = contenders.Contains(seat);
+
+        if (amount > level) {
+            if (contender) {
+                const auto seats_paying = static_cast<Coins_t>(order.size() - k);
+                auto& pot = pots_.emplace_back(dead + (amount - level) * seats_paying);
+                pot.players = remaining;
+                level = amount;
+                dead = 0;
+            } else {
+                dead += amount - level;
+            }
+        }
+
+        if (contender) remaining.Erase(seat);
+    }
+
+    // Non-contenders who paid above every contender: nobody left to match it.
+    if (pots_.empty()) {
+        pots_.emplace_back(0);
+    }
+    pots_.back().amount += dead;
+    current_pot_idx_ = pots_.size() - 1;
+}
+
+TableState Table::SaveState() const {
+    TableState state;
+    state.blind_small = blind_small_;
+    state.blind_big = blind_big_;
+    state.pot = pot_;
+    state.community_cards = community_cards_;
+    state.community_set = community_set_;
+    for (const auto& pot : pots_) {
+        auto& saved = state.pots.emplace_back();
+        saved.amount = pot.amount;
+        saved.players = pot.players.GetMask();
+    }
+    state.current_pot_idx = static_cast<std::uint8_t>(current_pot_idx_);
+    return state;
+}
+
+void Table::RestoreState(const TableState& state) {
+    blind_small_ = state.blind_small;
+    blind_big_ = state.blind_big;
+    pot_ = state.pot;
+    community_cards_ = state.community_cards;
+    community_set_ = state.community_set;
+
+    pots_.clear();
+    for (const auto& saved : state.pots) {
+        auto& pot = pots_.emplace_back(saved.amount);
+        pot.players = SeatMask(saved.players);
+    }
+    current_pot_idx_ = state.current_pot_idx;
+}
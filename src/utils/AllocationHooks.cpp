@@ -0,0 +1,107 @@
+// Replacement global operator new / delete that feed AllocationCounter.
+// Built as its own object library (pokerlib_alloc_hooks), never as part of
+// pokerlib_core: only executables that opt in get their allocator replaced.
+
+#include "utils/AllocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+
+void* RawAllocate(std::size_t size) noexcept {
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* RawAllocateAligned(std::size_t size, std::align_val_t alignment) noexcept {
+    const auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+    // The MSVC runtime has no aligned_alloc; these blocks need _aligned_free.
+    return _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+    // aligned_alloc wants a size that is a multiple of the alignment.
+    const auto rounded = (size + align - 1) / align * align;
+    return std::aligned_alloc(align, rounded == 0 ? align : rounded);
+#endif
+}
+
+void FreeAligned(void* ptr) noexcept {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+// Like the standard operator new: on failure run the new-handler (which may
+// free memory or throw) and retry; with no handler installed, throw.
+template <typename F>
+void* AllocateOrThrow(std::size_t size, F&& try_allocate) {
+    AllocationCounter::Record(size);
+    for (;;) {
+        if (void* ptr = try_allocate()) return ptr;
+        const auto handler = std::get_new_handler();
+        if (handler == nullptr) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* Allocate(std::size_t size) {
+    return AllocateOrThrow(size, [size] { return RawAllocate(size); });
+}
+
+void* AllocateAligned(std::size_t size, std::align_val_t alignment) {
+    return AllocateOrThrow(size, [size, alignment] { return RawAllocateAligned(size, alignment); });
+}
+
+// The nothrow forms behave as the throwing ones with bad_alloc caught.
+template <typename F>
+void* AllocateNoThrow(F&& allocate) noexcept {
+    try {
+        return allocate();
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+[[maybe_unused]] const bool kInstalled = [] {
+    AllocationCounter::detail::hooks_installed.store(true, std::memory_order_relaxed);
+    return true;
+}();
+
+} // namespace
+
+void* operator new(std::size_t size) { return Allocate(size); }
+void* operator new[](std::size_t size) { return Allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return AllocateAligned(size, alignment); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return AllocateNoThrow([size] { return Allocate(size); });
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return AllocateNoThrow([size] { return Allocate(size); });
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return AllocateNoThrow([size, alignment] { return AllocateAligned(size, alignment); });
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return AllocateNoThrow([size, alignment] { return AllocateAligned(size, alignment); });
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(ptr); }
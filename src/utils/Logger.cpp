@@ -0,0 +1,184 @@
+#include "utils/Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// Owns every thread's ring and the writer thread that drains them. A ring
+// outlives its thread until the drain after it is retired, so the thread's
+// last records are still written.
+class LogBackend {
+public:
+    static LogBackend& Instance() {
+        static LogBackend backend;
+        return backend;
+    }
+
+    LogBackend()
+        : writer_([this] { Run(); }) {}
+
+    ~LogBackend() {
+        stopping_.store(true, std::memory_order_relaxed);
+        writer_.join();
+        Flush();
+    }
+
+    log_detail::LogRing& Register() {
+        std::lock_guard lock(rings_mutex_);
+        rings_.push_back({std::make_unique<log_detail::LogRing>()});
+        return *rings_.back().ring;
+    }
+
+    // Called by the owning thread after its last push.
+    void Retire(const log_detail::LogRing& ring) {
+        std::lock_guard lock(rings_mutex_);
+        for (auto& slot : rings_) {
+            if (slot.ring.get() == &ring) slot.retired = true;
+        }
+    }
+
+    void SetSink(std::ostream& sink) {
+        std::lock_guard lock(drain_mutex_);
+        sink_ = &sink;
+    }
+
+    void Flush() {
+        std::lock_guard lock(drain_mutex_);
+        DrainLocked();
+        sink_->flush();
+    }
+
+private:
+    struct RingSlot {
+        std::unique_ptr<log_detail::LogRing> ring;
+        bool retired{false};
+    };
+
+    std::mutex rings_mutex_; // Guards rings_ only; never held while writing.
+    std::vector<RingSlot> rings_;
+
+    std::mutex drain_mutex_; // One consumer at a time; guards the members below.
+    std::vector<std::pair<log_detail::LogRing*, bool>> draining_;
+    std::ostream* sink_{&std::cout};
+    std::string line_;
+
+    std::atomic<bool> stopping_{false};
+    std::thread writer_; // Last: started once the rest is constructed.
+
+    void Run() {
+        // Producers never signal: waking the writer would cost them a
+        // syscall. It polls instead and sleeps while the rings are empty.
+        while (!stopping_.load(std::memory_order_relaxed)) {
+            std::size_t written = 0;
+            {
+                std::lock_guard lock(drain_mutex_);
+                written = DrainLocked();
+                if (written > 0) sink_->flush();
+            }
+            if (written == 0) std::this_thread::sleep_for(10ms);
+        }
+    }
+
+    std::size_t DrainLocked() {
+        // Registering a thread must not wait on the sink, so the drain works
+        // on a copy of the ring list. Only a consumer frees rings, and only
+        // after a drain that began once they were retired.
+        {
+            std::lock_guard lock(rings_mutex_);
+            draining_.clear();
+            for (const auto& slot : rings_) draining_.emplace_back(slot.ring.get(), slot.retired);
+        }
+
+        std::size_t written = 0;
+        bool any_retired = false;
+        for (const auto& [ring, retired] : draining_) {
+            if (const auto dropped = ring->TakeDropped(); dropped > 0) {
+                *sink_ << "[WARNING] " << dropped << " log records dropped (ring full)\n";
+            }
+            written += ring->Drain([this](const log_detail::LogRecord& record) { Write(record); });
+            any_retired |= retired;
+        }
+
+        if (any_retired) {
+            std::lock_guard lock(rings_mutex_);
+            std::erase_if(rings_, [this](const RingSlot& slot) {
+                return std::find(draining_.begin(), draining_.end(),
+                                 std::pair(slot.ring.get(), true)) != draining_.end();
+            });
+        }
+        return written;
+    }
+
+    void Write(const log_detail::LogRecord& record) {
+        const std::chrono::system_clock::time_point time{
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::nanoseconds(record.time_ns))};
+        const auto seconds = std::chrono::system_clock::to_time_t(time);
+        const auto ms = (record.time_ns / 1'000'000) % 1000;
+        // Only the writer calls this, so localtime's shared buffer is safe.
+        const std::tm* tm = std::localtime(&seconds);
+
+        line_ = std::format("[{:02}:{:02}:{:02}.{:03}] [{}] ",
+                            tm->tm_hour, tm->tm_min, tm->tm_sec, ms, Logger::ToString(record.level));
+        line_ += record.format(record.fmt, record.payload.data());
+        line_ += '\n';
+        *sink_ << line_;
+    }
+};
+
+} // namespace
+
+namespace log_detail {
+
+namespace {
+
+// Both trivially destructible, so they stay readable while the thread's
+// other thread_local objects are destroyed (and may still log).
+thread_local LogRing* this_thread_ring = nullptr;
+thread_local bool this_thread_exited = false;
+
+struct RingOwner {
+    LogRing& ring = LogBackend::Instance().Register();
+
+    ~RingOwner() {
+        this_thread_ring = nullptr;
+        this_thread_exited = true;
+        LogBackend::Instance().Retire(ring);
+    }
+};
+
+} // namespace
+
+LogRing* ThisThreadRing() {
+    if (this_thread_ring == nullptr && !this_thread_exited) [[unlikely]] {
+        thread_local RingOwner owner;
+        this_thread_ring = &owner.ring;
+    }
+    return this_thread_ring;
+}
+
+std::int64_t NowNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace log_detail
+
+void Logger::SetSink(std::ostream& sink) {
+    LogBackend::Instance().SetSink(sink);
+}
+
+void Logger::Flush() {
+    LogBackend::Instance().Flush();
+}
@@ -0,0 +1,130 @@
+#include "utils/ThreadPool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+// Lets Submit recognise calls made from one of this pool's workers.
+thread_local const ThreadPool* tls_pool = nullptr;
+thread_local std::size_t tls_worker_index = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t thread_count) {
+    thread_count = std::max<std::size_t>(thread_count, 1);
+    queues_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i) {
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    workers_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i) {
+        workers_.emplace_back([this, i] { WorkerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    task_available_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::Submit(Task_t task) {
+    pending_tasks_.fetch_add(1, std::memory_order_relaxed);
+
+    const std::size_t target = (tls_pool == this)
+        ? tls_worker_index
+        : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+    // Counted under mutex_ so a worker about to sleep cannot miss it, and
+    // before the push so a thief can never take the count below zero.
+    {
+        std::lock_guard lock(mutex_);
+        queued_tasks_.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        auto& queue = *queues_[target];
+        std::lock_guard lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    task_available_.notify_one();
+}
+
+void ThreadPool::Wait() {
+    std::unique_lock lock(mutex_);
+    all_done_.wait(lock, [this] { return pending_tasks_.load(std::memory_order_acquire) == 0; });
+
+    if (first_error_) {
+        auto error = std::exchange(first_error_, nullptr);
+        std::rethrow_exception(error);
+    }
+}
+
+std::size_t ThreadPool::GetThreadCount() const noexcept {
+    return workers_.size();
+}
+
+bool ThreadPool::TryPop(std::size_t worker_index, Task_t& task) {
+    {
+        auto& own = *queues_[worker_index];
+        std::lock_guard lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queued_tasks_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < queues_.size(); ++offset) {
+        auto& victim = *queues_[(worker_index + offset) % queues_.size()];
+        std::lock_guard lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued_tasks_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::Run(Task_t& task, std::size_t worker_index) {
+    try {
+        task(worker_index);
+    } catch (...) {
+        std::lock_guard lock(mutex_);
+        if (!first_error_) first_error_ = std::current_exception();
+    }
+    task = nullptr;
+
+    if (pending_tasks_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard lock(mutex_);
+        all_done_.notify_all();
+    }
+}
+
+void ThreadPool::WorkerLoop(std::size_t worker_index) {
+    tls_pool = this;
+    tls_worker_index = worker_index;
+
+    Task_t task;
+    while (true) {
+        if (TryPop(worker_index, task)) {
+            Run(task, worker_index);
+            continue;
+        }
+
+        std::unique_lock lock(mutex_);
+        task_available_.wait(lock, [this] {
+            return stopping_ || queued_tasks_.load(std::memory_order_relaxed) > 0;
+        });
+        if (stopping_ && queued_tasks_.load(std::memory_order_relaxed) == 0) return;
+    }
+}
@@ -0,0 +1,140 @@
+#include "utils/Trace.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace {
+
+// A thread's buffer stays registered after the thread exits, trimmed to its
+// events, so a dump after the workers are gone still sees them.
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<TraceBuffer>> buffers;
+    std::uint32_t next_thread_id{1};
+    // Tick / clock pair taken at start-up; a second pair at dump time gives
+    // the tick rate.
+    std::int64_t origin_ticks{Tracer::Now()};
+    std::chrono::steady_clock::time_point origin_time{std::chrono::steady_clock::now()};
+
+    TraceBuffer& Add() {
+        std::lock_guard lock(mutex);
+        buffers.push_back(std::make_unique<TraceBuffer>(next_thread_id++));
+        return *buffers.back();
+    }
+
+    void Retire(TraceBuffer& buffer) {
+        std::lock_guard lock(mutex);
+        if (buffer.GetSize() == 0 && buffer.GetDropped() == 0) {
+            std::erase_if(buffers, [&](const auto& owned) { return owned.get() == &buffer; });
+        } else {
+            buffer.ShrinkToFit();
+        }
+    }
+};
+
+TraceRegistry& Registry() {
+    static TraceRegistry registry;
+    return registry;
+}
+
+// Both trivially destructible, so a span closing in another thread_local
+// destructor can still check them after the owner is gone.
+thread_local TraceBuffer* this_thread_buffer = nullptr;
+thread_local bool this_thread_exited = false;
+
+struct BufferOwner {
+    TraceBuffer& buffer = Registry().Add();
+
+    ~BufferOwner() {
+        this_thread_buffer = nullptr;
+        this_thread_exited = true;
+        Registry().Retire(buffer);
+    }
+};
+
+TraceBuffer* AcquireThisThreadBuffer() {
+    if (this_thread_buffer == nullptr && !this_thread_exited) [[unlikely]] {
+        thread_local BufferOwner owner;
+        this_thread_buffer = &owner.buffer;
+    }
+    return this_thread_buffer;
+}
+
+} // namespace
+
+void Tracer::SetEnabled(bool enabled) {
+    Registry(); // Takes the time origin before the first span starts.
+    if (enabled) RegisterThisThread();
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void Tracer::RegisterThisThread() {
+    AcquireThisThreadBuffer();
+}
+
+TraceBuffer& Tracer::ThisThreadBuffer() {
+    return *AcquireThisThreadBuffer();
+}
+
+void Tracer::Record(const TraceEvent& event) {
+    if (auto* buffer = AcquireThisThreadBuffer()) buffer->Push(event);
+}
+
+void Tracer::WriteChromeJson(std::ostream& out) {
+    auto& registry = Registry();
+    std::lock_guard lock(registry.mutex);
+
+    const auto dump_ticks = Tracer::Now() - registry.origin_ticks;
+    const std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - registry.origin_time;
+    const double micros_per_tick = (dump_ticks > 0) ? elapsed.count() / static_cast<double>(dump_ticks) : 0.0;
+
+    // Chrome wants microseconds; keep the sub-microsecond part as decimals.
+    const auto micros = [&](std::int64_t ticks) { return static_cast<double>(ticks) * micros_per_tick; };
+
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& buffer : registry.buffers) {
+        const auto size = buffer->GetSize();
+        for (std::size_t i = 0; i < size; ++i) {
+            const auto& event = (*buffer)[i];
+            out << (first ? "\n" : ",\n")
+                << R"({"name":")" << event.name
+                << R"(","ph":"X","pid":1,"tid":)" << buffer->GetThreadId()
+                << R"(,"ts":)" << micros(event.start_ticks - registry.origin_ticks)
+                << R"(,"dur":)" << micros(event.duration_ticks) << "}";
+            first = false;
+        }
+        if (const auto dropped = buffer->GetDropped(); dropped > 0) {
+            out << (first ? "\n" : ",\n")
+                << R"({"name":"dropped )" << dropped << R"( events","ph":"i","s":"t","pid":1,"tid":)"
+                << buffer->GetThreadId() << R"(,"ts":0})";
+            first = false;
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+std::uint64_t Tracer::GetDropped() {
+    auto& registry = Registry();
+    std::lock_guard lock(registry.mutex);
+    std::uint64_t dropped = 0;
+    for (const auto& buffer : registry.buffers) dropped += buffer->GetDropped();
+    return dropped;
+}
+
+void Tracer::Clear() {
+    auto& registry = Registry();
+    std::lock_guard lock(registry.mutex);
+    for (auto& buffer : registry.buffers) buffer->Clear();
+}
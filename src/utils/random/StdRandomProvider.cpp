@@ -1,8 +1,20 @@
 #include "utils/random/StdRandomProvider.hpp"
 
+#include <algorithm>
+#include <cassert>
+
 StdRandomProvider::StdRandomProvider(uint64_t seed)
     : rng_(seed) {}
 
-void StdRandomProvider::Shuffle(std::vector<Card>& cards) {
+void StdRandomProvider::Shuffle(std::span<Card> cards) {
     std::shuffle(cards.begin(), cards.end(), rng_);
 }
+
+std::size_t StdRandomProvider::UniformIndex(std::size_t bound) noexcept {
+    assert(bound > 0);
+    return std::uniform_int_distribution<std::size_t>(0, bound - 1)(rng_);
+}
+
+void StdRandomProvider::Reseed(std::uint64_t seed) {
+    rng_.seed(static_cast<std::mt19937::result_type>(seed));
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include "sim/HandSimulator.hpp"
+
+#include "utils/AllocationCounter.hpp"
+#include "utils/Logger.hpp"
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <new>
+#include <thread>
+
+namespace {
+
+class AllocationCounterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(AllocationCounter::IsInstalled()) << "runTests must link pokerlib_alloc_hooks";
+    }
+
+    const ScopedLogLevel quiet_{LogLevel::WARNING};
+};
+
+} // namespace
+
+TEST_F(AllocationCounterTest, CountsThisThreadsAllocations) {
+    const AllocationScope scope;
+    auto value = std::make_unique<std::int64_t>(7);
+    auto values = std::make_unique<std::int64_t[]>(8);
+
+    const auto elapsed = scope.Elapsed();
+    EXPECT_EQ(elapsed.allocations, 2u);
+    EXPECT_GE(elapsed.bytes, 9 * sizeof(std::int64_t));
+}
+
+TEST_F(AllocationCounterTest, OtherThreadsAreNotCounted) {
+    std::atomic<bool> go{false};
+    std::thread other([&go] {
+        while (!go.load()) std::this_thread::yield();
+        auto value = std::make_unique<int>(1);
+    });
+
+    const AllocationScope scope;
+    go.store(true);
+    other.join();
+    EXPECT_EQ(scope.Elapsed().allocations, 0u);
+}
+
+TEST_F(AllocationCounterTest, FailedAllocationRunsTheNewHandler) {
+    static int handler_calls = 0;
+    handler_calls = 0;
+    // Gives up on the first call, so the retry throws.
+    const auto previous = std::set_new_handler([] {
+        ++handler_calls;
+        std::set_new_handler(nullptr);
+    });
+
+    EXPECT_THROW(static_cast<void>(::operator new(std::numeric_limits<std::size_t>::max() / 2)), std::bad_alloc);
+    EXPECT_EQ(::operator new(std::numeric_limits<std::size_t>::max() / 2, std::nothrow), nullptr);
+    std::set_new_handler(previous);
+
+    EXPECT_EQ(handler_calls, 1);
+}
+
+TEST_F(AllocationCounterTest, SteadyStateHandDoesNotAllocate) {
+    HandSimulator simulator({.players = 6, .seed = 11, .agent = EAgentKind::RANDOM});
+
+    // First hands may allocate once (e.g. this thread's log ring).
+    SimulationStats warm_up;
+    for (int i = 0; i < 10; ++i) simulator.PlayHand(warm_up);
+
+    SimulationStats stats;
+    const AllocationScope scope;
+    for (int i = 0; i < 200; ++i) simulator.PlayHand(stats);
+
+    EXPECT_EQ(scope.Elapsed(), AllocationCount{});
+    for (const auto& count : stats.allocations) {
+        EXPECT_EQ(count, AllocationCount{});
+    }
+}
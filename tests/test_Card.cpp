@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+
+#include "Config.hpp"
+
+#include "core/Card.hpp"
+
+TEST(CardTest, RoundTripsEverySuitAndRank) {
+    for (const auto suit : {ECardSuit::HEARTS, ECardSuit::DIAMONDS, ECardSuit::CLUBS, ECardSuit::SPADES}) {
+        for (int r = static_cast<int>(ECardRank::TWO); r <= static_cast<int>(ECardRank::ACE); ++r) {
+            const auto rank = static_cast<ECardRank>(r);
+            const Card card{suit, rank};
+            EXPECT_EQ(card.GetSuit(), suit);
+            EXPECT_EQ(card.GetRank(), rank);
+            EXPECT_EQ(Card::FromId(card.GetId()), card);
+        }
+    }
+}
+
+TEST(CardTest, DeckHoldsEveryIdOnce) {
+    static_assert(sizeof(kCardDeck) == Card::kCount);
+
+    std::array<bool, Card::kCount> seen {};
+    for (const auto& card : kCardDeck) {
+        ASSERT_LT(card.GetId(), Card::kCount);
+        EXPECT_FALSE(seen[card.GetId()]);
+        seen[card.GetId()] = true;
+    }
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include "core/Card.hpp"
+#include "core/CardSet.hpp"
+
+#include "table/PlayerList.hpp"
+#include "table/PlayerSession.hpp"
+#include "table/Table.hpp"
+
+#include "utils/Translator.hpp"
+
+#include <vector>
+
+TEST(CardSetTest, InsertContainsAndErase) {
+    const Card ace{ECardSuit::HEARTS, ECardRank::ACE};
+    const Card king{ECardSuit::SPADES, ECardRank::KING};
+
+    CardSet set;
+    EXPECT_TRUE(set.Empty());
+    set.Insert(ace);
+    set.Insert(ace);
+    EXPECT_TRUE(set.Contains(ace));
+    EXPECT_FALSE(set.Contains(king));
+    EXPECT_EQ(set.Count(), 1);
+
+    set.Erase(ace);
+    EXPECT_TRUE(set.Empty());
+}
+
+TEST(CardSetTest, SetOperations) {
+    const Card a{ECardSuit::HEARTS, ECardRank::ACE};
+    const Card b{ECardSuit::SPADES, ECardRank::KING};
+    const Card c{ECardSuit::CLUBS, ECardRank::TWO};
+
+    const CardSet lhs {a, b};
+    const CardSet rhs {b, c};
+
+    EXPECT_EQ((lhs | rhs).Count(), 3);
+    EXPECT_EQ((lhs & rhs), CardSet({b}));
+    EXPECT_EQ((lhs - rhs), CardSet({a}));
+    EXPECT_TRUE(lhs.Intersects(rhs));
+    EXPECT_EQ(CardSet::Full().Count(), Card::kCount);
+    EXPECT_EQ(lhs.Complement().Count(), Card::kCount - 2);
+    EXPECT_FALSE(lhs.Complement().Contains(a));
+}
+
+TEST(CardSetTest, IteratesInIdOrder) {
+    const CardSet set {
+        {ECardSuit::SPADES, ECardRank::ACE},
+        {ECardSuit::CLUBS, ECardRank::TWO},
+        {ECardSuit::HEARTS, ECardRank::TEN}
+    };
+
+    std::vector<Card> cards(set.begin(), set.end());
+    ASSERT_EQ(cards.size(), 3);
+    EXPECT_EQ(cards[0], Card(ECardSuit::CLUBS, ECardRank::TWO));
+    EXPECT_EQ(cards[1], Card(ECardSuit::HEARTS, ECardRank::TEN));
+    EXPECT_EQ(cards[2], Card(ECardSuit::SPADES, ECardRank::ACE));
+}
+
+TEST(CardSetTest, SessionAndTableKeepSetsInSync) {
+    const Card a{ECardSuit::HEARTS, ECardRank::ACE};
+    const Card b{ECardSuit::SPADES, ECardRank::KING};
+
+    PlayerList list;
+    list.SitPlayerAt(Player("A", 100), 0);
+    auto session = list.GetSession(0);
+    session.AddCard(a);
+    session.AddCard(b);
+    EXPECT_EQ(session.GetHandSet(), CardSet({a, b}));
+    session.ClearHand();
+    EXPECT_TRUE(session.GetHandSet().Empty());
+
+    Table table(1, 2);
+    table.AddCommunityCard(a);
+    EXPECT_EQ(table.GetCommunityCardSet(), CardSet({a}));
+    table.ClearCommunityCards();
+    EXPECT_TRUE(table.GetCommunityCardSet().Empty());
+}
+
+TEST(CardSetTest, RankFromCardSetMatchesOrderedEvaluation) {
+    const PlayerSession::Hand_t hand {{
+        {ECardSuit::HEARTS, ECardRank::ACE},
+        {ECardSuit::SPADES, ECardRank::KING}
+    }};
+    const std::vector<Card> board {
+        {ECardSuit::HEARTS, ECardRank::KING},
+        {ECardSuit::CLUBS, ECardRank::TWO},
+        {ECardSuit::DIAMONDS, ECardRank::SEVEN},
+        {ECardSuit::HEARTS, ECardRank::TEN}
+    };
+
+    const auto cards = CardSet::FromCards(hand) | CardSet::FromCards(board);
+    EXPECT_EQ(Translator::RankFromCardSet(cards).value(),
+              Translator::RankFromPlayerTableCards(hand, board).value());
+}
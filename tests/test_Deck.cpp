@@ -1,22 +1,45 @@
 #include <gtest/gtest.h>
 
+#include "Config.hpp"
+
 #include "core/Card.hpp"
+#include "core/CardSet.hpp"
 #include "core/Deck.hpp"
 
+#include "utils/random/EngineRandomProvider.hpp"
 #include "utils/random/IRandomProvider.hpp"
+#include "utils/random/StdRandomProvider.hpp"
+
+#include <array>
+#include <vector>
 
 // Mock for provider: do shuffle nothing
 class MockRandomProvider : public IRandomProvider {
 public:
-    void Shuffle(std::vector<Card>& cards) override {}
+    void Shuffle(std::span<Card> /*cards*/) override {}
+    std::size_t UniformIndex(std::size_t /*bound*/) noexcept override { return 0; }
+    void Reseed(std::uint64_t /*seed*/) override {}
 };
 
 // Mock for provider: reverse cards.
 class ReverseMockRandomProvider : public IRandomProvider {
 public:
-    void Shuffle(std::vector<Card>& cards) override {
+    void Shuffle(std::span<Card> cards) override {
         std::reverse(cards.begin(), cards.end());
     }
+    std::size_t UniformIndex(std::size_t bound) noexcept override { return bound - 1; }
+    void Reseed(std::uint64_t /*seed*/) override {}
+};
+
+// Mock for provider: counts calls.
+class CountingRandomProvider : public IRandomProvider {
+public:
+    void Shuffle(std::span<Card> /*cards*/) override { ++shuffles; }
+    std::size_t UniformIndex(std::size_t bound) noexcept override { ++draws; return bound - 1; }
+    void Reseed(std::uint64_t /*seed*/) override {}
+
+    int shuffles{0};
+    int draws{0};
 };
 
 TEST(DeckTest, DrawsSequentiallyWithoutShuffle) {
@@ -89,4 +112,97 @@ TEST(DeckTest, ShuffleAfterPartialDraw) {
     EXPECT_TRUE(c2.has_value());
     EXPECT_TRUE(c3.has_value());
     EXPECT_FALSE(deck.Draw().has_value());
-}
\ No newline at end of file
+}
+
+TEST(DeckTest, DealOnDemandShuffleDoesNotTouchProvider) {
+    CountingRandomProvider rng;
+    Deck deck(kCardDeck, rng, EDeckMode::DEAL_ON_DEMAND);
+
+    deck.Shuffle();
+    EXPECT_EQ(rng.shuffles, 0);
+    EXPECT_EQ(rng.draws, 0);
+
+    (void)deck.Draw();
+    (void)deck.Draw();
+    EXPECT_EQ(rng.draws, 2);
+}
+
+TEST(DeckTest, DealOnDemandSwapsPickedCardIntoPlace) {
+    std::vector<Card> cards = {
+        {ECardSuit::HEARTS, ECardRank::TWO},
+        {ECardSuit::SPADES, ECardRank::THREE},
+        {ECardSuit::DIAMONDS, ECardRank::FOUR}
+    };
+    ReverseMockRandomProvider rng; // Always picks the last undealt card.
+    Deck deck(cards, rng, EDeckMode::DEAL_ON_DEMAND);
+
+    EXPECT_EQ(deck.Draw(), cards[2]);
+    EXPECT_EQ(deck.Draw(), cards[0]);
+    EXPECT_EQ(deck.Draw(), cards[1]);
+    EXPECT_FALSE(deck.Draw().has_value());
+}
+
+TEST(DeckTest, DealOnDemandDealsEveryCardOnce) {
+    StdRandomProvider rng(7);
+    Deck deck(kCardDeck, rng, EDeckMode::DEAL_ON_DEMAND);
+
+    for (int hand = 0; hand < 3; ++hand) {
+        deck.Shuffle();
+        CardSet seen;
+        while (const auto card = deck.Draw()) {
+            EXPECT_FALSE(seen.Contains(*card));
+            seen.Insert(*card);
+        }
+        EXPECT_EQ(seen.Count(), Card::kCount);
+    }
+}
+
+TEST(DeckTest, DealOnDemandFirstCardIsUniform) {
+    StdRandomProvider rng(2024);
+    Deck deck(kCardDeck, rng, EDeckMode::DEAL_ON_DEMAND);
+
+    constexpr int kHands = 52 * 2000;
+    std::array<int, Card::kCount> counts{};
+    for (int i = 0; i < kHands; ++i) {
+        deck.Shuffle();
+        ++counts[deck.Draw()->GetId()];
+        (void)deck.Draw();
+    }
+
+    // Expected 2000 per card; +-15% is far outside sampling noise (~2.2%).
+    for (const auto count : counts) {
+        EXPECT_NEAR(count, 2000, 300);
+    }
+}
+
+
+TEST(DeckTest, DealOnDemandRestoreReplaysTheSameDraws) {
+    XoshiroRandomProvider rng(99);
+    Deck deck(kCardDeck, rng, EDeckMode::DEAL_ON_DEMAND);
+    deck.Shuffle();
+    for (int i = 0; i < 5; ++i) (void)deck.Draw();
+
+    const auto snapshot = deck.SaveState();
+    EXPECT_EQ(snapshot.mode, EDeckMode::DEAL_ON_DEMAND);
+    ASSERT_TRUE(snapshot.has_rng_state);
+
+    std::vector<Card> first;
+    for (int i = 0; i < 10; ++i) first.push_back(*deck.Draw());
+
+    ASSERT_TRUE(deck.RestoreState(snapshot));
+    for (int i = 0; i < 10; ++i) EXPECT_EQ(deck.Draw(), first[i]) << "draw " << i;
+}
+
+TEST(DeckTest, RestoreRejectsDealOnDemandWithoutRandomState) {
+    StdRandomProvider rng(99);
+    Deck deck(kCardDeck, rng, EDeckMode::DEAL_ON_DEMAND);
+    deck.Shuffle();
+
+    const auto snapshot = deck.SaveState();
+    EXPECT_FALSE(snapshot.has_rng_state);
+    EXPECT_FALSE(snapshot.CanRestore());
+
+    (void)deck.Draw();
+    EXPECT_FALSE(deck.RestoreState(snapshot));
+    EXPECT_EQ(deck.SaveState().next_card_index, 1);
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "core/Card.hpp"
+#include "core/Player.hpp"
+
+#include "equity/EquityCalculator.hpp"
+
+#include "table/PlayerList.hpp"
+#include "table/Table.hpp"
+
+#include <stdexcept>
+
+namespace {
+
+EquityInput MakeInput(std::initializer_list<PlayerSession::Hand_t> hands, std::initializer_list<Card> board = {}) {
+    EquityInput input;
+    std::size_t seat = 0;
+    for (const auto& hand : hands) input.players.push_back({seat++, hand});
+    for (const auto card : board) input.board.push_back(card);
+    return input;
+}
+
+const PlayerSession::Hand_t kAces {{{ECardSuit::HEARTS, ECardRank::ACE}, {ECardSuit::SPADES, ECardRank::ACE}}};
+const PlayerSession::Hand_t kKings {{{ECardSuit::HEARTS, ECardRank::KING}, {ECardSuit::SPADES, ECardRank::KING}}};
+
+} // namespace
+
+TEST(EquityCalculatorTest, CompleteBoardIsDecided) {
+    EquityCalculator calculator(2);
+    const auto input = MakeInput({kAces, kKings}, {
+        {ECardSuit::CLUBS, ECardRank::TWO},
+        {ECardSuit::DIAMONDS, ECardRank::SEVEN},
+        {ECardSuit::CLUBS, ECardRank::NINE},
+        {ECardSuit::DIAMONDS, ECardRank::JACK},
+        {ECardSuit::CLUBS, ECardRank::FOUR}
+    });
+
+    const auto result = calculator.RunMonteCarlo(input, 100, 1);
+    EXPECT_EQ(result.seats[0].wins, 100);
+    EXPECT_EQ(result.seats[1].wins, 0);
+    EXPECT_DOUBLE_EQ(result.GetEquity(0), 1.0);
+}
+
+TEST(EquityCalculatorTest, BoardPlaysIsASplit) {
+    EquityCalculator calculator(2);
+    const auto input = MakeInput({kAces, kKings}, {
+        {ECardSuit::CLUBS, ECardRank::TEN},
+        {ECardSuit::CLUBS, ECardRank::JACK},
+        {ECardSuit::CLUBS, ECardRank::QUEEN},
+        {ECardSuit::CLUBS, ECardRank::KING},
+        {ECardSuit::CLUBS, ECardRank::ACE}
+    });
+
+    const auto result = calculator.RunMonteCarlo(input, 10, 1);
+    EXPECT_EQ(result.seats[0].ties[2], 10);
+    EXPECT_DOUBLE_EQ(result.GetEquity(0), 0.5);
+    EXPECT_DOUBLE_EQ(result.GetEquity(1), 0.5);
+}
+
+TEST(EquityCalculatorTest, AcesAgainstKingsPreflop) {
+    EquityCalculator calculator(4);
+    const auto result = calculator.RunMonteCarlo(MakeInput({kAces, kKings}), 40000, 42);
+
+    EXPECT_EQ(result.trials, 40000);
+    EXPECT_NEAR(result.GetEquity(0), 0.82, 0.02);
+    EXPECT_NEAR(result.GetEquity(0) + result.GetEquity(1), 1.0, 1e-9);
+}
+
+TEST(EquityCalculatorTest, SameSeedSameResultAcrossThreadCounts) {
+    const auto input = MakeInput({kAces, kKings}, {
+        {ECardSuit::CLUBS, ECardRank::TWO},
+        {ECardSuit::DIAMONDS, ECardRank::SEVEN},
+        {ECardSuit::CLUBS, ECardRank::KING}
+    });
+
+    EquityCalculator one_thread(1);
+    EquityCalculator many_threads(3);
+    const auto a = one_thread.RunMonteCarlo(input, 50000, 7);
+    const auto b = many_threads.RunMonteCarlo(input, 50000, 7);
+    EXPECT_EQ(a.seats[0].wins, b.seats[0].wins);
+    EXPECT_EQ(a.seats[1].wins, b.seats[1].wins);
+}
+
+TEST(EquityCalculatorTest, RejectsInvalidInput) {
+    EquityCalculator calculator(1);
+    EXPECT_THROW((void)calculator.RunMonteCarlo(MakeInput({kAces}), 10, 1), std::invalid_argument);
+    EXPECT_THROW((void)calculator.RunMonteCarlo(MakeInput({kAces, kAces}), 10, 1), std::invalid_argument);
+}
+
+TEST(EquityCalculatorTest, FromTableTakesActiveSeats) {
+    PlayerList player_list;
+    player_list.SitPlayerAt(Player("A", 100), 2);
+    player_list.SitPlayerAt(Player("B", 100), 5);
+    player_list.SitPlayerAt(Player("C", 100), 7);
+    player_list.GetSession(2).AddCard(kAces[0]);
+    player_list.GetSession(2).AddCard(kAces[1]);
+    player_list.GetSession(7).AddCard(kKings[0]);
+    player_list.GetSession(7).AddCard(kKings[1]);
+    player_list.SetFold(5, true);
+
+    Table table(1, 2);
+    table.AddCommunityCard({ECardSuit::CLUBS, ECardRank::TWO});
+
+    const auto input = EquityInput::FromTable(player_list, table);
+    ASSERT_EQ(input.players.size(), 2);
+    EXPECT_EQ(input.players[0].seat, 2);
+    EXPECT_EQ(input.players[1].seat, 7);
+    EXPECT_EQ(input.players[1].hand, kKings);
+    EXPECT_EQ(input.board.size(), 1);
+}
+
+TEST(EquityCalculatorTest, ExhaustiveTurnCountsEveryRiver) {
+    EquityCalculator calculator(2);
+    const auto input = MakeInput({kAces, kKings}, {
+        {ECardSuit::CLUBS, ECardRank::TWO},
+        {ECardSuit::DIAMONDS, ECardRank::SEVEN},
+        {ECardSuit::CLUBS, ECardRank::NINE},
+        {ECardSuit::DIAMONDS, ECardRank::JACK}
+    });
+
+    const auto result = calculator.RunExhaustive(input);
+    EXPECT_EQ(result.trials, 44);
+    // Only the two remaining kings save the underdog.
+    EXPECT_EQ(result.seats[1].wins, 2);
+    EXPECT_EQ(result.seats[0].wins, 42);
+}
+
+TEST(EquityCalculatorTest, ExhaustiveFlopIsDeterministicAndAgreesWithSampling) {
+    EquityCalculator calculator(4);
+    const auto input = MakeInput({kAces, kKings}, {
+        {ECardSuit::CLUBS, ECardRank::TWO},
+        {ECardSuit::DIAMONDS, ECardRank::SEVEN},
+        {ECardSuit::CLUBS, ECardRank::NINE}
+    });
+
+    ASSERT_TRUE(EquityCalculator::PrefersExhaustive(input));
+    const auto first = calculator.Run(input, 1'000'000, 1);
+    const auto second = calculator.RunExhaustive(input);
+    EXPECT_EQ(first.trials, 990);
+    EXPECT_EQ(first.seats[0].wins, second.seats[0].wins);
+    EXPECT_EQ(first.seats[1].wins, second.seats[1].wins);
+
+    const auto sampled = calculator.RunMonteCarlo(input, 40000, 3);
+    EXPECT_NEAR(sampled.GetEquity(0), first.GetEquity(0), 0.02);
+}
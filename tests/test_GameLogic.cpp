@@ -18,13 +18,17 @@
 #include "mocks/MockDeck.hpp"
 #include "mocks/MockTable.hpp"
 
-#include <unordered_set>
 #include <algorithm>
+#include <initializer_list>
+#include <stdexcept>
 
 using ::testing::Return;
 using ::testing::ReturnRef;
 using ::testing::_;
 
+static_assert(DeckType<MockDeck> && TableType<MockTable>);
+static_assert(DeckType<Deck> && TableType<Table>);
+
 // --- Fixture ---
 class GameLogicTest : public ::testing::Test {
 protected:
@@ -34,8 +38,8 @@ protected:
     std::unique_ptr<IRandomProvider> rng_;
     std::unique_ptr<GameLogic> logic_;
 
-    std::vector<Card> default_community_cards_;
-    std::vector<Pot> default_pots_;
+    ITable::CommunityCards_t default_community_cards_;
+    ITable::Pots_t default_pots_;
 
     void SetUp() override {
         mock_deck_ = std::make_unique<testing::NiceMock<MockDeck>>();
@@ -52,8 +56,8 @@ protected:
         // Always return the same card for simplicity in mocks
         std::optional<Card> fake_card = Card{ECardSuit::HEARTS, ECardRank::ACE};
         EXPECT_CALL(*mock_deck_, Draw()).WillRepeatedly(Return(fake_card));
-        EXPECT_CALL(*mock_table_, GetBlindSmall()).WillRepeatedly(Return(2.0));
-        EXPECT_CALL(*mock_table_, GetBlindBig()).WillRepeatedly(Return(4.0));
+        EXPECT_CALL(*mock_table_, GetBlindSmall()).WillRepeatedly(Return(2));
+        EXPECT_CALL(*mock_table_, GetBlindBig()).WillRepeatedly(Return(4));
 
         ON_CALL(*mock_table_, GetCommunityCards())
             .WillByDefault(ReturnRef(default_community_cards_));
@@ -63,14 +67,20 @@ protected:
         logic_ = std::make_unique<GameLogic>(*mock_deck_, *mock_table_, player_list_);
     }
 
-    static Player MakePlayer(const std::string& name, Coins_t chips = 100.0) {
+    static Player MakePlayer(const std::string& name, Coins_t chips = 100) {
         return Player(name, chips);
     }
+
+    // mock_deck_ deals exactly `cards`: two per occupied seat in seat order, then the board.
+    void DealInOrder(std::initializer_list<Card> cards) {
+        auto& draw = EXPECT_CALL(*mock_deck_, Draw());
+        for (const auto& card : cards) draw.WillOnce(Return(std::optional<Card>{card}));
+    }
 };
 
 TEST_F(GameLogicTest, BlindArePaidOnStartingHand) {
-    const Coins_t sb = 2.0;
-    const Coins_t bb = 4.0;
+    const Coins_t sb = 2;
+    const Coins_t bb = 4;
     Deck deck(kCardDeck, *rng_);
     Table table(sb, bb);
     logic_ = std::make_unique<GameLogic>(deck, table, player_list_);
@@ -83,20 +93,20 @@ TEST_F(GameLogicTest, BlindArePaidOnStartingHand) {
     EXPECT_EQ(logic_->GetState(), ELogicState::PREFLOP);
     
     // Player 1 substracted bb
-    auto& player_1 = player_list_.GetPlayer(1);
-    EXPECT_DOUBLE_EQ(player_1.GetStack(), player_1_stack_init - sb);
+    const auto& player_1 = player_list_.GetPlayer(1);
+    EXPECT_EQ(player_1.GetStack(), player_1_stack_init - sb);
 
     // Player 2 substracted bb
-    auto& player_2 = player_list_.GetPlayer(2);
-    EXPECT_DOUBLE_EQ(player_2.GetStack(), player_2_stack_init - bb);
+    const auto& player_2 = player_list_.GetPlayer(2);
+    EXPECT_EQ(player_2.GetStack(), player_2_stack_init - bb);
 
     // Pot state
     const auto& pots = table.GetPots();
     EXPECT_EQ(pots.size(), 1);
-    EXPECT_DOUBLE_EQ(pots[0].amount, sb + bb);
+    EXPECT_EQ(pots[0].amount, sb + bb);
 
     auto& pot_players = pots[0].players;
-    const std::unordered_set<std::size_t> expected_players {1, 2};
+    const SeatMask expected_players {1, 2};
     EXPECT_EQ(pot_players, expected_players);
 }
 
@@ -114,8 +124,8 @@ TEST_F(GameLogicTest, TransitionBetweenAllStates) {
         {ELogicState::FLOP, ELogicState::TURN, ELogicState::RIVER, ELogicState::SHOWDOWN}
     };
     for (std::size_t i = 0; i < expected_states.size(); ++i) {
-        logic_->ProcessPlayerAction({EPlayerAction::BET, 10.0});
-        logic_->ProcessPlayerAction({EPlayerAction::BET, 10.0});
+        logic_->ProcessPlayerAction({EPlayerAction::BET, 10});
+        logic_->ProcessPlayerAction({EPlayerAction::BET, 10});
         
         EXPECT_TRUE(logic_->IsBettingRoundComplete());
         
@@ -129,6 +139,85 @@ TEST_F(GameLogicTest, TransitionBetweenAllStates) {
     EXPECT_EQ(logic_->GetState(), ELogicState::HAND_FINISHED);
 }
 
+TEST_F(GameLogicTest, BigBlindGetsTheOptionPreflop) {
+    logic_->StartHand(); // dealer 0, blinds 1 / 2, seat 3 first to act
+
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 4}); // 3
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 4}); // 0
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 4}); // 1
+    EXPECT_FALSE(logic_->IsBettingRoundComplete());
+    EXPECT_EQ(logic_->GetCurrentPlayerIndex(), 2);
+
+    logic_->ProcessPlayerAction({EPlayerAction::CHECK, 0}); // 2
+    EXPECT_TRUE(logic_->IsBettingRoundComplete());
+}
+
+TEST_F(GameLogicTest, EverySeatChecksBeforeThePostflopRoundEnds) {
+    logic_->StartHand();
+    for (std::size_t i = 0; i < 3; ++i) logic_->ProcessPlayerAction({EPlayerAction::CALL, 4});
+    logic_->ProcessPlayerAction({EPlayerAction::CHECK, 0});
+    logic_->AdvanceState();
+    ASSERT_EQ(logic_->GetState(), ELogicState::FLOP);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        logic_->ProcessPlayerAction({EPlayerAction::CHECK, 0});
+        EXPECT_FALSE(logic_->IsBettingRoundComplete());
+    }
+    logic_->ProcessPlayerAction({EPlayerAction::CHECK, 0});
+    EXPECT_TRUE(logic_->IsBettingRoundComplete());
+}
+
+TEST_F(GameLogicTest, RaiseReopensActionAndAllInSeatsAreSkipped) {
+    player_list_.GetPlayer(0).SetStack(20);
+    logic_->StartHand();
+
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 4});    // 3
+    logic_->ProcessPlayerAction({EPlayerAction::ALL_IN, 20}); // 0
+    logic_->ProcessPlayerAction({EPlayerAction::FOLD, 0});    // 1
+    logic_->ProcessPlayerAction({EPlayerAction::RAISE, 40});  // 2
+
+    // 3 called before both raises and must act again; 0 is all-in.
+    EXPECT_FALSE(logic_->IsBettingRoundComplete());
+    EXPECT_EQ(logic_->GetCurrentPlayerIndex(), 3);
+
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 40});   // 3
+    EXPECT_TRUE(logic_->IsBettingRoundComplete());
+    EXPECT_EQ(logic_->GetHighestBet(), 40);
+}
+
+TEST_F(GameLogicTest, ShortAllInRaiseDoesNotReopenTheBetting) {
+    player_list_.GetPlayer(0).SetStack(16);
+    logic_->StartHand();
+    EXPECT_EQ(logic_->GetMinRaise(), 8);
+
+    logic_->ProcessPlayerAction({EPlayerAction::RAISE, 12});  // 3: raises by 8
+    EXPECT_EQ(logic_->GetMinRaise(), 20);
+    logic_->ProcessPlayerAction({EPlayerAction::ALL_IN, 16}); // 0: only 4 more
+    EXPECT_EQ(logic_->GetHighestBet(), 16);
+    EXPECT_EQ(logic_->GetMinRaise(), 24);
+
+    logic_->ProcessPlayerAction({EPlayerAction::FOLD, 0});    // 1
+    logic_->ProcessPlayerAction({EPlayerAction::FOLD, 0});    // 2
+
+    // 3 still owes the 4 chips, but faced no full raise so may not re-raise.
+    EXPECT_FALSE(logic_->IsBettingRoundComplete());
+    EXPECT_EQ(logic_->GetCurrentPlayerIndex(), 3);
+    EXPECT_FALSE(logic_->CanRaise());
+    EXPECT_THROW(logic_->ProcessPlayerAction({EPlayerAction::RAISE, 40}), std::invalid_argument);
+
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 16});   // 3
+    EXPECT_TRUE(logic_->IsBettingRoundComplete());
+    EXPECT_EQ(logic_->GetHighestBet(), 16);
+}
+
+TEST_F(GameLogicTest, RaiseBelowTheMinimumIsRejected) {
+    logic_->StartHand();
+    EXPECT_TRUE(logic_->CanRaise());
+    EXPECT_THROW(logic_->ProcessPlayerAction({EPlayerAction::RAISE, 6}), std::invalid_argument);
+    EXPECT_EQ(logic_->GetCurrentPlayerIndex(), 3);
+    EXPECT_EQ(logic_->GetHighestBet(), 4);
+}
+
 TEST_F(GameLogicTest, NoMorePlayersWithChipsAfterAllIn) {
     player_list_.ClearPlayers();
     player_list_.SitPlayerAt(MakePlayer("A", 100), 0); // dealer
@@ -136,25 +225,25 @@ TEST_F(GameLogicTest, NoMorePlayersWithChipsAfterAllIn) {
     player_list_.SitPlayerAt(MakePlayer("C", 100), 2); // big blind
     player_list_.SitPlayerAt(MakePlayer("D", 100), 3); 
 
-    const Coins_t sb = 2.0;
-    const Coins_t bb = 4.0;
+    const Coins_t sb = 2;
+    const Coins_t bb = 4;
     Deck deck(kCardDeck, *rng_);
     Table table(sb, bb);
     logic_ = std::make_unique<GameLogic>(deck, table, player_list_);
 
     logic_->StartHand();
 
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // A (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // B (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // C (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // D (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // A (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // B (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // C (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // D (all-in)
 
     // Check Pot
-    const std::unordered_set<std::size_t> expected_pot_players {0, 1, 2, 3};
+    const SeatMask expected_pot_players {0, 1, 2, 3};
     const auto& pots = table.GetPots();
     EXPECT_EQ(pots.size(), 1);
     EXPECT_EQ(pots[0].players, expected_pot_players);
-    EXPECT_DOUBLE_EQ(pots[0].amount, 100.0 * 4.0);
+    EXPECT_EQ(pots[0].amount, 100 * 4);
 
     // Check Logic State
     EXPECT_EQ(logic_->GetState(), ELogicState::SHOWDOWN);
@@ -162,18 +251,18 @@ TEST_F(GameLogicTest, NoMorePlayersWithChipsAfterAllIn) {
 
     for (const auto i : player_list_.GetActiveSeatIndices()) {
         const auto& player = player_list_.GetPlayer(i);
-        EXPECT_EQ(player.GetStack(), 0.0);
+        EXPECT_EQ(player.GetStack(), 0);
     }
 
     logic_->AdvanceState();
 
     // Check hand finished and prize payment
     EXPECT_EQ(logic_->GetState(), ELogicState::HAND_FINISHED);
-    EXPECT_DOUBLE_EQ(pots[0].amount, 0.0);
+    EXPECT_EQ(pots[0].amount, 0);
 
     const auto players = player_list_.GetActiveSeatIndices();
     EXPECT_TRUE(std::any_of(players.cbegin(), players.cend(), [&](const auto i) {
-        return (player_list_.GetPlayer(i).GetStack() > 0.0);
+        return (player_list_.GetPlayer(i).GetStack() > 0);
     }));
 }
 
@@ -184,18 +273,18 @@ TEST_F(GameLogicTest, OnePlayerWithChipsAfterAllIn) {
     player_list_.SitPlayerAt(MakePlayer("C", 100), 2); // big blind
     player_list_.SitPlayerAt(MakePlayer("D", 100), 3); 
 
-    const Coins_t sb = 2.0;
-    const Coins_t bb = 4.0;
+    const Coins_t sb = 2;
+    const Coins_t bb = 4;
     Deck deck(kCardDeck, *rng_);
     Table table(sb, bb);
     logic_ = std::make_unique<GameLogic>(deck, table, player_list_);
 
     logic_->StartHand();
 
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 25.0}); // A (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 25.0}); // B
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 25.0}); // C
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 25.0}); // D
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 25}); // A (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 25}); // B
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 25}); // C
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 25}); // D
 
     
 }
@@ -206,17 +295,17 @@ TEST_F(GameLogicTest, LogicEdgeCase1) {
     player_list_.SitPlayerAt(MakePlayer("B", 150), 1); // small blind
     player_list_.SitPlayerAt(MakePlayer("C", 150), 2); // big blind
 
-    const Coins_t sb = 2.0;
-    const Coins_t bb = 4.0;
+    const Coins_t sb = 2;
+    const Coins_t bb = 4;
     Deck deck(kCardDeck, *rng_);
     Table table(sb, bb);
     logic_ = std::make_unique<GameLogic>(deck, table, player_list_);
 
     logic_->StartHand();
 
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // A (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // B
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // C
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // A (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // B
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // C
     // Pot 0 => 0, 1, 2; 300 chips
 
     logic_->AdvanceState();
@@ -226,8 +315,8 @@ TEST_F(GameLogicTest, LogicEdgeCase1) {
     EXPECT_EQ(table.GetCommunityCards().size(), 3);
 
     // A is not playing anymore. Waiting for hand to finish.
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 25.0}); // B
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 50.0}); // C (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 25}); // B
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 50}); // C (all-in)
     logic_->ProcessPlayerAction({EPlayerAction::FOLD}); // B
     // Pot 1 => 1, 2; 75 chips
 
@@ -254,25 +343,25 @@ TEST_F(GameLogicTest, LogicEdgeCase2) {
     player_list_.SitPlayerAt(MakePlayer("B", 150), 1); // small blind
     player_list_.SitPlayerAt(MakePlayer("C", 150), 2); // big blind
     
-    const Coins_t sb = 2.0;
-    const Coins_t bb = 4.0;
+    const Coins_t sb = 2;
+    const Coins_t bb = 4;
     Deck deck(kCardDeck, *rng_);
     Table table(sb, bb);
     logic_ = std::make_unique<GameLogic>(deck, table, player_list_);
 
     logic_->StartHand();
 
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // A (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // B
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // C
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // A (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // B
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // C
     // Pot 0 => 0, 1, 2; 300 chips
 
     logic_->AdvanceState();
     
     // A is not playing anymore. Waiting for hand to finish.
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 25.0}); // B
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 50.0}); // C (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 50.0}); // B (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 25}); // B
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 50}); // C (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 50}); // B (all-in)
     
     logic_->AdvanceState();
     
@@ -280,10 +369,10 @@ TEST_F(GameLogicTest, LogicEdgeCase2) {
     const auto& pots = table.GetPots();
     EXPECT_EQ(pots.size(), 2);
     
-    const std::unordered_set<std::size_t> expected_players_pot0 {0, 1, 2};
+    const SeatMask expected_players_pot0 {0, 1, 2};
     EXPECT_EQ(pots[0].players, expected_players_pot0);
 
-    const std::unordered_set<std::size_t> expected_players_pot1 {1, 2};
+    const SeatMask expected_players_pot1 {1, 2};
     EXPECT_EQ(pots[1].players, expected_players_pot1);
 
     EXPECT_EQ(logic_->GetState(), ELogicState::SHOWDOWN);
@@ -304,17 +393,17 @@ TEST_F(GameLogicTest, LogicEdgeCase3) {
     player_list_.SitPlayerAt(MakePlayer("B", 120), 1); // small blind
     player_list_.SitPlayerAt(MakePlayer("C", 100), 2); // big blind
     
-    const Coins_t sb = 2.0;
-    const Coins_t bb = 4.0;
+    const Coins_t sb = 2;
+    const Coins_t bb = 4;
     Deck deck(kCardDeck, *rng_);
     Table table(sb, bb);
     logic_ = std::make_unique<GameLogic>(deck, table, player_list_);
 
     logic_->StartHand();
 
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 150.0}); // A (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 120.0}); // B (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // C (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 150}); // A (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 120}); // B (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // C (all-in)
     // Pot 0 => 0, 1, 2; 300 chips
     // Pot 1 => 0, 1; 240 chips
     // Pot 2 => 0; 30 chips // Or not pot 2.
@@ -329,13 +418,13 @@ TEST_F(GameLogicTest, LogicEdgeCase3) {
     const auto& pots = table.GetPots();
     EXPECT_EQ(pots.size(), 3);
     
-    const std::unordered_set<std::size_t> expected_players_pot0 {0, 1, 2};
+    const SeatMask expected_players_pot0 {0, 1, 2};
     EXPECT_EQ(pots[0].players, expected_players_pot0);
 
-    const std::unordered_set<std::size_t> expected_players_pot1 {0, 1};
+    const SeatMask expected_players_pot1 {0, 1};
     EXPECT_EQ(pots[1].players, expected_players_pot1);
 
-    const std::unordered_set<std::size_t> expected_players_pot2 {0};
+    const SeatMask expected_players_pot2 {0};
     EXPECT_EQ(pots[2].players, expected_players_pot2);*/
 }
 
@@ -345,19 +434,19 @@ TEST_F(GameLogicTest, LogicEdgeCase4) {
     player_list_.SitPlayerAt(MakePlayer("B", 120), 1); // small blind
     player_list_.SitPlayerAt(MakePlayer("C", 100), 2); // big blind
     
-    const Coins_t sb = 2.0;
-    const Coins_t bb = 4.0;
+    const Coins_t sb = 2;
+    const Coins_t bb = 4;
     Deck deck(kCardDeck, *rng_);
     Table table(sb, bb);
     logic_ = std::make_unique<GameLogic>(deck, table, player_list_);
 
     logic_->StartHand();
 
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 80.0}); // A
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 80.0}); // B
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 100.0}); // C (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 150.0}); // A (all-in)
-    logic_->ProcessPlayerAction({EPlayerAction::BET, 120.0}); // B (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 80}); // A
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 80}); // B
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // C (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 150}); // A (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 120}); // B (all-in)
 
     // Pot 0 => 0, 1, 2; 300 chips
     // Pot 1 => 0, 1; 240 chips
@@ -373,12 +462,75 @@ TEST_F(GameLogicTest, LogicEdgeCase4) {
     const auto& pots = table.GetPots();
     EXPECT_EQ(pots.size(), 3);
     
-    const std::unordered_set<std::size_t> expected_players_pot0 {0, 1, 2};
+    const SeatMask expected_players_pot0 {0, 1, 2};
     EXPECT_EQ(pots[0].players, expected_players_pot0);
 
-    const std::unordered_set<std::size_t> expected_players_pot1 {0, 1};
+    const SeatMask expected_players_pot1 {0, 1};
     EXPECT_EQ(pots[1].players, expected_players_pot1);
 
-    const std::unordered_set<std::size_t> expected_players_pot2 {0};
+    const SeatMask expected_players_pot2 {0};
     EXPECT_EQ(pots[2].players, expected_players_pot2);*/
-}
\ No newline at end of file
+}
+
+TEST_F(GameLogicTest, TiedShowdownSplitsPotAndOddChipGoesLeftOfButton) {
+    player_list_.ClearPlayers();
+    player_list_.SitPlayerAt(MakePlayer("A"), 0); // dealer
+    player_list_.SitPlayerAt(MakePlayer("B"), 1); // small blind
+    player_list_.SitPlayerAt(MakePlayer("C"), 2); // big blind
+
+    DealInOrder({
+        {ECardSuit::HEARTS, ECardRank::ACE}, {ECardSuit::DIAMONDS, ECardRank::KING},   // A
+        {ECardSuit::CLUBS, ECardRank::THREE}, {ECardSuit::DIAMONDS, ECardRank::FOUR},  // B
+        {ECardSuit::DIAMONDS, ECardRank::ACE}, {ECardSuit::HEARTS, ECardRank::KING},   // C
+        {ECardSuit::CLUBS, ECardRank::TWO}, {ECardSuit::DIAMONDS, ECardRank::SEVEN},
+        {ECardSuit::HEARTS, ECardRank::NINE}, {ECardSuit::SPADES, ECardRank::JACK},
+        {ECardSuit::CLUBS, ECardRank::QUEEN}});
+    Table table(1, 2);
+    logic_ = std::make_unique<GameLogic>(*mock_deck_, table, player_list_);
+
+    logic_->StartHand();
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // A (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::FOLD, 0});  // B, 1 chip dead
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 100}); // C (all-in)
+
+    ASSERT_EQ(logic_->GetState(), ELogicState::SHOWDOWN);
+    logic_->AdvanceState();
+    EXPECT_EQ(logic_->GetState(), ELogicState::HAND_FINISHED);
+
+    // 201 chips split between A and C; the odd one goes to C, first left of the button.
+    EXPECT_EQ(player_list_.GetPlayer(0).GetStack(), 100);
+    EXPECT_EQ(player_list_.GetPlayer(1).GetStack(), 99);
+    EXPECT_EQ(player_list_.GetPlayer(2).GetStack(), 101);
+}
+
+TEST_F(GameLogicTest, ShortStackWinsOnlyTheMainPot) {
+    player_list_.ClearPlayers();
+    player_list_.SitPlayerAt(MakePlayer("A", 50), 0); // dealer
+    player_list_.SitPlayerAt(MakePlayer("B"), 1);     // small blind
+    player_list_.SitPlayerAt(MakePlayer("C"), 2);     // big blind
+
+    DealInOrder({
+        {ECardSuit::HEARTS, ECardRank::ACE}, {ECardSuit::SPADES, ECardRank::ACE},      // A
+        {ECardSuit::HEARTS, ECardRank::KING}, {ECardSuit::SPADES, ECardRank::KING},    // B
+        {ECardSuit::HEARTS, ECardRank::QUEEN}, {ECardSuit::SPADES, ECardRank::QUEEN},  // C
+        {ECardSuit::CLUBS, ECardRank::TWO}, {ECardSuit::DIAMONDS, ECardRank::SEVEN},
+        {ECardSuit::HEARTS, ECardRank::NINE}, {ECardSuit::SPADES, ECardRank::JACK},
+        {ECardSuit::CLUBS, ECardRank::THREE}});
+    Table table(1, 2);
+    logic_ = std::make_unique<GameLogic>(*mock_deck_, table, player_list_);
+
+    logic_->StartHand();
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 50});  // A (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::BET, 100}); // B (all-in)
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 100}); // C (all-in)
+
+    ASSERT_EQ(logic_->GetState(), ELogicState::SHOWDOWN);
+    logic_->AdvanceState();
+
+    // Main pot 150 to A; side pot 100 between B and C to B.
+    EXPECT_EQ(player_list_.GetPlayer(0).GetStack(), 150);
+    EXPECT_EQ(player_list_.GetPlayer(1).GetStack(), 100);
+    EXPECT_EQ(player_list_.GetPlayer(2).GetStack(), 0);
+    ASSERT_EQ(table.GetPots().size(), 1);
+    EXPECT_EQ(table.GetPots()[0].amount, 0);
+}
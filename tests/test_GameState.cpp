@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include "Config.hpp"
+
+#include "core/Deck.hpp"
+
+#include "game_logic/GameLogic.hpp"
+#include "game_logic/GameState.hpp"
+
+#include "table/PlayerList.hpp"
+#include "table/Table.hpp"
+
+#include "utils/Logger.hpp"
+#include "utils/random/StdRandomProvider.hpp"
+
+#include <cstring>
+#include <string>
+
+class GameStateTest : public ::testing::Test {
+protected:
+    const ScopedLogLevel quiet_{LogLevel::WARNING};
+    StdRandomProvider rng_{1234};
+    Deck deck_{kCardDeck, rng_};
+    Table table_{kBlindSmall, kBlindBig};
+    PlayerList player_list_;
+    std::unique_ptr<GameLogic> logic_;
+
+    void SetUp() override {
+        for (std::size_t i = 0; i < 4; ++i) {
+            player_list_.SitPlayer(Player("P" + std::to_string(i), 100));
+        }
+        logic_ = std::make_unique<GameLogic>(deck_, table_, player_list_);
+        logic_->StartHand();
+    }
+
+    void ExpectSameAs(const GameState& expected) const {
+        const auto actual = logic_->SaveState();
+
+        EXPECT_EQ(actual.logic.state, expected.logic.state);
+        EXPECT_EQ(actual.logic.current_player_index, expected.logic.current_player_index);
+        EXPECT_EQ(actual.logic.highest_bet, expected.logic.highest_bet);
+        EXPECT_EQ(actual.deck.cards, expected.deck.cards);
+        EXPECT_EQ(actual.deck.next_card_index, expected.deck.next_card_index);
+        EXPECT_EQ(actual.table.community_cards, expected.table.community_cards);
+        ASSERT_EQ(actual.table.pots.size(), expected.table.pots.size());
+        for (std::size_t i = 0; i < actual.table.pots.size(); ++i) {
+            EXPECT_EQ(actual.table.pots[i].amount, expected.table.pots[i].amount);
+            EXPECT_EQ(actual.table.pots[i].players, expected.table.pots[i].players);
+        }
+        for (std::size_t seat = 0; seat < PlayerList::kMaxPlayers; ++seat) {
+            const auto& a = actual.players.seats[seat];
+            const auto& e = expected.players.seats[seat];
+            EXPECT_EQ(a.stack, e.stack) << "seat " << seat;
+            EXPECT_EQ(a.session.hand, e.session.hand) << "seat " << seat;
+            EXPECT_EQ(a.session.last_bet, e.session.last_bet) << "seat " << seat;
+            EXPECT_EQ(a.session.is_fold, e.session.is_fold) << "seat " << seat;
+        }
+    }
+};
+
+TEST_F(GameStateTest, RestoreRewindsActionsAndDealtCards) {
+    const auto snapshot = logic_->SaveState();
+
+    logic_->ProcessPlayerAction({EPlayerAction::RAISE, 20});
+    logic_->ProcessPlayerAction({EPlayerAction::FOLD});
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 20});
+    logic_->ProcessPlayerAction({EPlayerAction::CALL, 20});
+    ASSERT_TRUE(logic_->IsRoundFinished());
+    logic_->AdvanceState();
+    ASSERT_EQ(logic_->GetState(), ELogicState::FLOP);
+
+    logic_->RestoreState(snapshot);
+
+    EXPECT_EQ(logic_->GetState(), ELogicState::PREFLOP);
+    EXPECT_TRUE(table_.GetCommunityCards().empty());
+    ExpectSameAs(snapshot);
+}
+
+TEST_F(GameStateTest, ReplayingFromSnapshotIsDeterministic) {
+    const auto play = [this] {
+        logic_->ProcessPlayerAction({EPlayerAction::CALL, kBlindBig});
+        logic_->ProcessPlayerAction({EPlayerAction::CALL, kBlindBig});
+        logic_->ProcessPlayerAction({EPlayerAction::CALL, kBlindBig});
+        logic_->ProcessPlayerAction({EPlayerAction::CHECK});
+        if (logic_->IsRoundFinished()) logic_->AdvanceState();
+    };
+
+    const auto snapshot = logic_->SaveState();
+    play();
+    const auto after_first = logic_->SaveState();
+
+    logic_->RestoreState(snapshot);
+    play();
+    ExpectSameAs(after_first);
+}
+
+TEST_F(GameStateTest, SnapshotClonesWithMemcpy) {
+    const auto snapshot = logic_->SaveState();
+
+    GameState clone;
+    std::memcpy(&clone, &snapshot, sizeof(GameState));
+
+    logic_->ProcessPlayerAction({EPlayerAction::FOLD});
+    logic_->RestoreState(clone);
+    ExpectSameAs(snapshot);
+}
+
+TEST_F(GameStateTest, RestoreRejectsDifferentSeating) {
+    const auto snapshot = logic_->SaveState();
+
+    player_list_.RemovePlayer(1);
+    EXPECT_THROW(logic_->RestoreState(snapshot), std::invalid_argument);
+}
+
+TEST_F(GameStateTest, DirectLogicPlaysTheSameHandAsVirtualLogic) {
+    StdRandomProvider rng{1234};
+    Deck deck{kCardDeck, rng};
+    Table table{kBlindSmall, kBlindBig};
+    PlayerList player_list;
+    for (std::size_t i = 0; i < 4; ++i) {
+        player_list.SitPlayer(Player("P" + std::to_string(i), 100));
+    }
+    DirectGameLogic direct(deck, table, player_list);
+    direct.StartHand();
+
+    for (const Action action : {Action{EPlayerAction::RAISE, 12}, Action{EPlayerAction::CALL, 12},
+                                Action{EPlayerAction::FOLD}, Action{EPlayerAction::CALL, 12}}) {
+        logic_->ProcessPlayerAction(action);
+        direct.ProcessPlayerAction(action);
+    }
+    logic_->AdvanceState();
+    direct.AdvanceState();
+
+    ExpectSameAs(direct.SaveState());
+    EXPECT_EQ(direct.GetState(), ELogicState::FLOP);
+}
+
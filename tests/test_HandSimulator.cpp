@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include "sim/Agents.hpp"
+#include "sim/HandSimulator.hpp"
+
+#include "utils/Logger.hpp"
+
+namespace {
+
+AgentView MakeView(Coins_t stack, Coins_t last_bet, Coins_t highest_bet) {
+    return AgentView{
+        .seat = 0,
+        .state = ELogicState::PREFLOP,
+        .hand = {},
+        .stack = stack,
+        .last_bet = last_bet,
+        .highest_bet = highest_bet,
+        .big_blind = kBlindBig
+    };
+}
+
+class HandSimulatorTest : public ::testing::Test {
+protected:
+    const ScopedLogLevel quiet_{LogLevel::WARNING};
+};
+
+} // namespace
+
+TEST(AgentsTest, FoldWithNothingToCallBecomesCheck) {
+    const auto action = MakeLegalAction(EPlayerAction::FOLD, MakeView(100, 4, 4));
+    EXPECT_EQ(action.action, EPlayerAction::CHECK);
+    EXPECT_EQ(action.amount, 0);
+}
+
+TEST(AgentsTest, CallMatchesHighestBet) {
+    const auto action = MakeLegalAction(EPlayerAction::CALL, MakeView(100, 2, 4));
+    EXPECT_EQ(action.action, EPlayerAction::CALL);
+    EXPECT_EQ(action.amount, 4);
+}
+
+TEST(AgentsTest, ShortCallGoesAllIn) {
+    const auto action = MakeLegalAction(EPlayerAction::CALL, MakeView(10, 2, 50));
+    EXPECT_EQ(action.action, EPlayerAction::ALL_IN);
+    EXPECT_EQ(action.amount, 12);
+}
+
+TEST(AgentsTest, RaiseDoublesHighestBetAndIsCappedByStack) {
+    auto action = MakeLegalAction(EPlayerAction::RAISE, MakeView(100, 0, 4));
+    EXPECT_EQ(action.action, EPlayerAction::RAISE);
+    EXPECT_EQ(action.amount, 8);
+
+    action = MakeLegalAction(EPlayerAction::RAISE, MakeView(5, 0, 4));
+    EXPECT_EQ(action.action, EPlayerAction::ALL_IN);
+    EXPECT_EQ(action.amount, 5);
+}
+
+TEST_F(HandSimulatorTest, CallingAgentsAlwaysReachShowdown) {
+    HandSimulator simulator({.players = 4, .seed = 7, .agent = EAgentKind::CALLING});
+    const auto stats = simulator.Run(50);
+
+    EXPECT_EQ(stats.hands, 50u);
+    EXPECT_EQ(stats.showdowns, 50u);
+    EXPECT_EQ(simulator.GetGameLogic().GetState(), ELogicState::HAND_FINISHED);
+}
+
+TEST_F(HandSimulatorTest, FoldingScriptEndsHandsWithoutShowdown) {
+    HandSimulator simulator({.players = 3, .seed = 1, .agent = EAgentKind::SCRIPTED,
+                             .script = {EPlayerAction::FOLD}});
+    const auto stats = simulator.Run(20);
+
+    EXPECT_EQ(stats.hands, 20u);
+    EXPECT_EQ(stats.showdowns, 0u);
+}
+
+TEST_F(HandSimulatorTest, RandomAgentsFinishEveryHand) {
+    HandSimulator simulator({.players = 6, .seed = 42, .agent = EAgentKind::RANDOM});
+    const auto stats = simulator.Run(200);
+
+    EXPECT_EQ(stats.hands, 200u);
+    EXPECT_GT(stats.actions, 0u);
+}
+
+TEST_F(HandSimulatorTest, SameSeedGivesSameRun) {
+    HandSimulator a({.players = 5, .seed = 99, .agent = EAgentKind::RANDOM});
+    HandSimulator b({.players = 5, .seed = 99, .agent = EAgentKind::RANDOM});
+
+    const auto stats_a = a.Run(100);
+    const auto stats_b = b.Run(100);
+    EXPECT_EQ(stats_a.actions, stats_b.actions);
+    EXPECT_EQ(stats_a.showdowns, stats_b.showdowns);
+}
+
+TEST(HandSimulatorConfigTest, RejectsTooFewPlayers) {
+    EXPECT_THROW(HandSimulator({.players = 1}), std::invalid_argument);
+}
+
+TEST(HandSimulatorConfigTest, ValidateRejectsWhatTheConstructorRejects) {
+    EXPECT_THROW(HandSimulator::Validate({.players = 11}), std::invalid_argument);
+    EXPECT_THROW(HandSimulator::Validate({.agent = EAgentKind::SCRIPTED}), std::invalid_argument);
+    EXPECT_THROW(HandSimulator::Validate({.starting_stack = 0}), std::invalid_argument);
+    EXPECT_THROW(HandSimulator simulator({.starting_stack = -5}), std::invalid_argument);
+    EXPECT_NO_THROW(HandSimulator::Validate({}));
+}
+
+TEST_F(HandSimulatorTest, ReplayedHandMatchesSequentialRun) {
+    const SimulationConfig config{.players = 6, .seed = 77, .table_id = 3, .agent = EAgentKind::RANDOM};
+    constexpr std::uint64_t kHand = 37;
+
+    HandSimulator sequential(config);
+    SimulationStats before;
+    for (std::uint64_t i = 0; i < kHand; ++i) sequential.PlayHand(before);
+    SimulationStats sequential_hand;
+    sequential.PlayHand(sequential_hand);
+    const auto expected = sequential.GetGameLogic().SaveState();
+
+    HandSimulator replay(config);
+    SimulationStats replay_hand;
+    replay.ReplayHand(kHand, replay_hand);
+    const auto actual = replay.GetGameLogic().SaveState();
+
+    EXPECT_EQ(replay_hand.actions, sequential_hand.actions);
+    EXPECT_EQ(replay_hand.showdowns, sequential_hand.showdowns);
+    EXPECT_EQ(actual.logic.dealer_index, expected.logic.dealer_index);
+    EXPECT_EQ(actual.deck.cards, expected.deck.cards);
+    EXPECT_EQ(actual.table.community_cards, expected.table.community_cards);
+    for (std::size_t seat = 0; seat < config.players; ++seat) {
+        EXPECT_EQ(actual.players.seats[seat].stack, expected.players.seats[seat].stack);
+        EXPECT_EQ(actual.players.seats[seat].session.hand, expected.players.seats[seat].session.hand);
+    }
+    EXPECT_EQ(replay.GetNextHand(), 0u);
+}
+
+TEST_F(HandSimulatorTest, ButtonMovesOneSeatPerHand) {
+    HandSimulator simulator({.players = 3, .agent = EAgentKind::CALLING});
+    SimulationStats stats;
+    for (std::size_t hand = 0; hand < 7; ++hand) {
+        simulator.PlayHand(stats);
+        EXPECT_EQ(simulator.GetGameLogic().GetDealerIndex(), hand % 3);
+    }
+}
+
+TEST_F(HandSimulatorTest, PayoutConservesChips) {
+    const SimulationConfig config{.players = 6, .seed = 5, .agent = EAgentKind::RANDOM};
+    HandSimulator simulator(config);
+    SimulationStats stats;
+    for (std::size_t hand = 0; hand < 200; ++hand) {
+        simulator.PlayHand(stats);
+
+        Coins_t total = 0;
+        for (const auto stack : simulator.GetPlayerList().GetStacks()) total += stack;
+        ASSERT_EQ(total, config.starting_stack * static_cast<Coins_t>(config.players)) << "hand " << hand;
+    }
+}
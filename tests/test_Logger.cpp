@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "utils/Logger.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+class LoggerTest : public ::testing::Test {
+protected:
+    std::ostringstream sink_;
+    const ScopedLogLevel level_{LogLevel::INFO};
+
+    void SetUp() override {
+        Logger::Flush(); // Earlier tests' records go to the old sink.
+        Logger::SetSink(sink_);
+    }
+
+    void TearDown() override {
+        Logger::Flush();
+        Logger::SetSink(std::cout);
+    }
+};
+
+} // namespace
+
+TEST_F(LoggerTest, WritesLevelAndFormattedMessage) {
+    POKER_LOG_WARNING("seat {} stack {}", 3, 42);
+    Logger::Flush();
+
+    const auto out = sink_.str();
+    EXPECT_NE(out.find("[WARNING] seat 3 stack 42\n"), std::string::npos) << out;
+}
+
+TEST_F(LoggerTest, FilteredCallDoesNotEvaluateArguments) {
+    Logger::SetMinLevel(LogLevel::ERROR);
+    int evaluated = 0;
+    POKER_LOG_INFO("{}", ++evaluated);
+    POKER_LOG_DEBUG("{}", ++evaluated);
+    Logger::Flush();
+
+    EXPECT_EQ(evaluated, 0);
+    EXPECT_TRUE(sink_.str().empty());
+}
+
+TEST_F(LoggerTest, ScopedLogLevelRestoresThePreviousLevel) {
+    {
+        const ScopedLogLevel quiet(LogLevel::ERROR);
+        EXPECT_EQ(Logger::GetMinLevel(), LogLevel::ERROR);
+    }
+    EXPECT_EQ(Logger::GetMinLevel(), LogLevel::INFO);
+}
+
+TEST_F(LoggerTest, StringArgumentsAreCopiedIntoTheRecord) {
+    {
+        std::string name = "Alice";
+        POKER_LOG_INFO("player {}", name);
+        name = "Bob";
+    }
+    Logger::Flush();
+
+    EXPECT_NE(sink_.str().find("player Alice"), std::string::npos);
+}
+
+TEST_F(LoggerTest, RecordsFromEveryThreadArrive) {
+    constexpr int kThreads = 4;
+    constexpr int kRecords = 200;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < kRecords; ++i) POKER_LOG_INFO("thread {} record {}", t, i);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    Logger::Flush();
+
+    const auto out = sink_.str();
+    EXPECT_EQ(std::count(out.begin(), out.end(), '\n'), kThreads * kRecords);
+    EXPECT_NE(out.find("thread 3 record 199"), std::string::npos);
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include "sim/MultiTableRunner.hpp"
+
+#include "utils/Logger.hpp"
+
+class MultiTableRunnerTest : public ::testing::Test {
+protected:
+    const ScopedLogLevel quiet_{LogLevel::WARNING};
+};
+
+TEST_F(MultiTableRunnerTest, PlaysEveryHandOnEveryTable) {
+    MultiTableRunner runner(4);
+    const auto stats = runner.Run({.players = 6, .seed = 3}, 40, 25);
+
+    EXPECT_EQ(stats.hands, 40u * 25u);
+    EXPECT_GT(stats.actions, stats.hands);
+}
+
+TEST_F(MultiTableRunnerTest, ResultsDoNotDependOnThreadCount) {
+    const SimulationConfig config{.players = 5, .seed = 11};
+
+    MultiTableRunner single(1);
+    MultiTableRunner several(4);
+    const auto a = single.Run(config, 32, 20);
+    const auto b = several.Run(config, 32, 20);
+
+    EXPECT_EQ(a.hands, b.hands);
+    EXPECT_EQ(a.actions, b.actions);
+    EXPECT_EQ(a.showdowns, b.showdowns);
+}
+
+TEST_F(MultiTableRunnerTest, TableMatchesStandaloneSimulator) {
+    MultiTableRunner runner(2);
+    const auto from_runner = runner.Run({.players = 4, .seed = 21}, 1, 30);
+
+    HandSimulator simulator({.players = 4, .seed = 21, .table_id = 0});
+    const auto standalone = simulator.Run(30);
+
+    EXPECT_EQ(from_runner.actions, standalone.actions);
+    EXPECT_EQ(from_runner.showdowns, standalone.showdowns);
+}
+
+TEST_F(MultiTableRunnerTest, InvalidTableConfigSurfacesAsException) {
+    MultiTableRunner runner(2);
+    EXPECT_THROW((void)runner.Run({.players = 11}, 4, 1), std::invalid_argument);
+}
@@ -1,9 +1,10 @@
 #include <gtest/gtest.h>
 #include "table/PlayerList.hpp"
+#include "core/Card.hpp"
 #include "core/Player.hpp"
 /*
 // Helper
-Player MakePlayer(const std::string& name, Coins_t coins = 100.0) {
+Player MakePlayer(const std::string& name, Coins_t coins = 100) {
     return Player(name, coins);
 }
 
@@ -188,3 +189,130 @@ TEST(PlayerList, ResetSessionsClearsAllSessionState) {
     for (std::size_t i = 0; i < 3; ++i)
         EXPECT_FALSE(list.GetSession(i).IsFold());
 }*/
+
+TEST(PlayerListMasks, TrackSitAndRemove) {
+    PlayerList list;
+    list.SitPlayerAt(Player("A", 100), 2);
+    list.SitPlayerAt(Player("B", 100), 7);
+
+    EXPECT_EQ(list.GetOccupiedMask(), (SeatMask{2, 7}));
+    EXPECT_EQ(list.FindEmptySeat(), 0u);
+    EXPECT_EQ(list.NextEmptySeat(1), 3u);
+    EXPECT_EQ(list.LastOccupiedSeat(), 7u);
+
+    list.RemovePlayer(7);
+    EXPECT_EQ(list.GetOccupiedMask(), SeatMask{2});
+    EXPECT_EQ(list.NextOccupiedSeat(2), 2u);
+}
+
+TEST(PlayerListMasks, FoldAndAllInDriveSeatQueries) {
+    PlayerList list;
+    list.SitPlayerAt(Player("A", 100), 0);
+    list.SitPlayerAt(Player("B", 100), 4);
+    list.SitPlayerAt(Player("C", 100), 8);
+
+    list.SetFold(8, true);
+    EXPECT_TRUE(list.GetSession(8).IsFold());
+    EXPECT_EQ(list.GetActiveMask(), (SeatMask{0, 4}));
+    EXPECT_EQ(list.NextActiveSeat(4), 0u);
+    EXPECT_EQ(list.CountActiveSeats(), 2u);
+    EXPECT_EQ(list.GetActiveSeatIndices(), (SeatMask{0, 4}));
+
+    list.SetAllIn(4, true);
+    list.SetAllIn(8, true); // Folded seats do not count as all-in players.
+    EXPECT_EQ(list.CountAllInPlayers(), 1u);
+
+    list.NewHand();
+    EXPECT_TRUE(list.GetFoldedMask().Empty());
+    EXPECT_TRUE(list.GetAllInMask().Empty());
+    EXPECT_FALSE(list.GetSession(8).IsFold());
+    EXPECT_EQ(list.CountActiveSeats(), 3u);
+}
+
+TEST(PlayerListMasks, RestoreStateRebuildsMasks) {
+    PlayerList list;
+    list.SitPlayerAt(Player("A", 100), 1);
+    list.SitPlayerAt(Player("B", 100), 3);
+    list.SetFold(3, true);
+    const auto state = list.SaveState();
+
+    list.NewHand();
+    list.RestoreState(state);
+    EXPECT_EQ(list.GetFoldedMask(), SeatMask{3});
+    EXPECT_EQ(list.FindFirstActiveSeat(), 1u);
+}
+
+TEST(PlayerListColumns, RefsReadAndWriteTheColumns) {
+    PlayerList list;
+    list.SitPlayerAt(Player("A", 100), 2);
+    list.SitPlayerAt(Player("B", 50), 5);
+
+    EXPECT_EQ(list.GetPlayer(5).GetName(), "B");
+    list.GetPlayer(2).DecreaseStack(30);
+    EXPECT_EQ(list.GetStacks()[2], 70);
+
+    list.GetSession(2).SetLastBet(20);
+    list.GetSession(5).SetLastBet(20);
+    EXPECT_EQ(list.GetLastBets()[5], 20);
+
+    // Fold through the session ref is the same as through the list.
+    list.GetSession(5).SetFold(true);
+    EXPECT_EQ(list.GetFoldedMask(), SeatMask{5});
+
+    list.ClearLastBets();
+    EXPECT_EQ(list.GetSession(2).GetLastBet(), 0);
+}
+
+TEST(PlayerListSession, NewHandInitializesState) {
+    PlayerList list;
+    list.SitPlayerAt(Player("A", 100), 0);
+    auto session = list.GetSession(0);
+
+    EXPECT_FALSE(session.IsFold());
+    EXPECT_EQ(session.GetLastBet(), 0);
+    EXPECT_EQ(session.GetHand().size(), 2);
+    EXPECT_EQ(session.GetHand()[0], Card{});
+    EXPECT_EQ(session.GetHand()[1], Card{});
+}
+
+TEST(PlayerListSession, AddCardAndClearHand) {
+    PlayerList list;
+    list.SitPlayerAt(Player("A", 100), 0);
+    auto session = list.GetSession(0);
+    Card c1{ECardSuit::HEARTS, ECardRank::ACE};
+    Card c2{ECardSuit::SPADES, ECardRank::KING};
+    Card c3{ECardSuit::DIAMONDS, ECardRank::QUEEN};
+
+    EXPECT_TRUE(session.AddCard(c1));
+    EXPECT_TRUE(session.AddCard(c2));
+    EXPECT_FALSE(session.AddCard(c3)); // hand is full
+
+    const auto& hand = session.GetHand();
+    EXPECT_EQ(hand[0], c1);
+    EXPECT_EQ(hand[1], c2);
+
+    // After ClearHand the next card goes into the first slot again.
+    session.ClearHand();
+    Card c4{ECardSuit::CLUBS, ECardRank::TEN};
+    EXPECT_TRUE(session.AddCard(c4));
+    EXPECT_EQ(session.GetHand()[0], c4);
+}
+
+TEST(PlayerListSession, FoldAndBetLogic) {
+    PlayerList list;
+    list.SitPlayerAt(Player("A", 100), 0);
+    auto session = list.GetSession(0);
+
+    EXPECT_FALSE(session.IsFold());
+    session.SetFold(true);
+    EXPECT_TRUE(session.IsFold());
+
+    session.SetLastBet(25);
+    EXPECT_EQ(session.GetLastBet(), 25);
+
+    session.SetLastBet(0);
+    session.SetFold(false);
+
+    EXPECT_EQ(session.GetLastBet(), 0);
+    EXPECT_FALSE(session.IsFold());
+}
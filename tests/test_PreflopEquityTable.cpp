@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include "equity/PreflopEquityTable.hpp"
+
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+TEST(PreflopEquityTableTest, HandClassesCoverTheGrid) {
+    std::vector<bool> seen(PreflopEquityTable::kHandClasses, false);
+    std::size_t combos = 0;
+    for (std::size_t hand_class = 0; hand_class < PreflopEquityTable::kHandClasses; ++hand_class) {
+        for (const auto& hand : PreflopEquityTable::GetClassCombos(hand_class)) {
+            EXPECT_EQ(PreflopEquityTable::GetHandClass(hand), hand_class);
+            PlayerSession::Hand_t swapped {{hand[1], hand[0]}};
+            EXPECT_EQ(PreflopEquityTable::GetHandClass(swapped), hand_class);
+            ++combos;
+        }
+        seen[hand_class] = true;
+    }
+    EXPECT_EQ(combos, 1326);
+
+    const PlayerSession::Hand_t aces {{{ECardSuit::HEARTS, ECardRank::ACE}, {ECardSuit::SPADES, ECardRank::ACE}}};
+    const PlayerSession::Hand_t suited {{{ECardSuit::HEARTS, ECardRank::ACE}, {ECardSuit::HEARTS, ECardRank::KING}}};
+    const PlayerSession::Hand_t offsuit {{{ECardSuit::HEARTS, ECardRank::ACE}, {ECardSuit::CLUBS, ECardRank::KING}}};
+    EXPECT_EQ(PreflopEquityTable::GetClassCombos(PreflopEquityTable::GetHandClass(aces)).size(), 6);
+    EXPECT_EQ(PreflopEquityTable::GetClassCombos(PreflopEquityTable::GetHandClass(suited)).size(), 4);
+    EXPECT_EQ(PreflopEquityTable::GetClassCombos(PreflopEquityTable::GetHandClass(offsuit)).size(), 12);
+}
+
+TEST(PreflopEquityTableTest, WriteAndLoadRoundTrip) {
+    constexpr auto kClasses = PreflopEquityTable::kHandClasses;
+    std::vector<double> equities(kClasses * kClasses);
+    for (std::size_t i = 0; i < equities.size(); ++i) {
+        equities[i] = static_cast<double>(i % 1000) / 1000.0;
+    }
+
+    const auto path = (std::filesystem::temp_directory_path() / "poker_preflop_table_test.bin").string();
+    PreflopEquityTable::Write(path, equities);
+
+    const auto table = PreflopEquityTable::Load(path);
+    ASSERT_TRUE(table.IsLoaded());
+    EXPECT_NEAR(table.GetClassEquity(3, 7), equities[3 * kClasses + 7], 1e-4);
+    EXPECT_NEAR(table.GetClassEquity(168, 0), equities[168 * kClasses], 1e-4);
+
+    const PlayerSession::Hand_t hero {{{ECardSuit::HEARTS, ECardRank::ACE}, {ECardSuit::SPADES, ECardRank::ACE}}};
+    const PlayerSession::Hand_t villain {{{ECardSuit::HEARTS, ECardRank::SEVEN}, {ECardSuit::CLUBS, ECardRank::TWO}}};
+    const auto expected = equities[PreflopEquityTable::GetHandClass(hero) * kClasses + PreflopEquityTable::GetHandClass(villain)];
+    EXPECT_NEAR(table.GetEquity(hero, villain), expected, 1e-4);
+
+    std::filesystem::remove(path);
+}
+
+TEST(PreflopEquityTableTest, LoadRejectsMissingFile) {
+    EXPECT_THROW((void)PreflopEquityTable::Load("/nonexistent/preflop.bin"), std::runtime_error);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include "Config.hpp"
+
+#include "core/CardSet.hpp"
+
+#include "utils/random/Bounded.hpp"
+#include "utils/random/CounterRng.hpp"
+#include "utils/random/EngineRandomProvider.hpp"
+#include "utils/random/SeedHierarchy.hpp"
+#include "utils/random/StdRandomProvider.hpp"
+#include "utils/random/Xoshiro256.hpp"
+
+#include <array>
+#include <memory>
+#include <random>
+#include <vector>
+
+static_assert(std::uniform_random_bit_generator<Xoshiro256StarStar>);
+static_assert(std::uniform_random_bit_generator<CounterRng>);
+static_assert(std::uniform_random_bit_generator<SplitMix64>);
+
+TEST(Xoshiro256Test, MatchesReferenceOutput) {
+    // Reference implementation seeded with s = {1, 2, 3, 4}.
+    Xoshiro256StarStar rng(Xoshiro256StarStar::State_t{1, 2, 3, 4});
+    const std::array<std::uint64_t, 5> expected {
+        11520ULL, 0ULL, 1509978240ULL, 1215971899390074240ULL, 1216172134540287360ULL
+    };
+    for (const auto value : expected) {
+        EXPECT_EQ(rng(), value);
+    }
+}
+
+TEST(Xoshiro256Test, JumpMatchesReferenceState) {
+    Xoshiro256StarStar rng(Xoshiro256StarStar::State_t{1, 2, 3, 4});
+    rng.Jump();
+    const Xoshiro256StarStar::State_t expected {
+        0x8C7A153956B5F3D1ULL, 0x701F1A713401D85EULL, 0x6527F66A65469085ULL, 0x8386B786C4408050ULL
+    };
+    EXPECT_EQ(rng.GetState(), expected);
+}
+
+TEST(Xoshiro256Test, SplitHandsOutCurrentStreamAndJumps) {
+    Xoshiro256StarStar parent(42);
+    const auto before = parent;
+
+    auto child = parent.Split();
+    EXPECT_EQ(child, before);
+
+    auto jumped = before;
+    jumped.Jump();
+    EXPECT_EQ(parent, jumped);
+    EXPECT_NE(child(), parent());
+}
+
+TEST(CounterRngTest, OutputIsAFunctionOfKeyAndCounter) {
+    CounterRng a(7);
+    for (int i = 0; i < 10; ++i) (void)a();
+
+    CounterRng b(7, 10);
+    EXPECT_EQ(a(), b());
+
+    CounterRng c(7);
+    c.Discard(11);
+    EXPECT_EQ(a(), c());
+}
+
+TEST(CounterRngTest, StreamsDiffer) {
+    CounterRng base(99);
+    auto s0 = base.Split(0);
+    auto s1 = base.Split(1);
+    CounterRng other(100);
+
+    EXPECT_NE(s0(), s1());
+    EXPECT_NE(base(), other());
+}
+
+TEST(BoundedTest, StaysInRangeAndHandlesBoundOne) {
+    Xoshiro256StarStar rng(5);
+    for (std::uint64_t bound : {1ULL, 2ULL, 3ULL, 52ULL, 1000ULL, (1ULL << 63) + 1}) {
+        for (int i = 0; i < 1000; ++i) {
+            EXPECT_LT(UniformBelow(rng, bound), bound);
+        }
+    }
+}
+
+TEST(BoundedTest, IsUniformOverSmallRange) {
+    CounterRng rng(3);
+    constexpr int kBuckets = 7;
+    constexpr int kDraws = kBuckets * 20000;
+    std::array<int, kBuckets> counts{};
+    for (int i = 0; i < kDraws; ++i) {
+        ++counts[UniformBelow(rng, kBuckets)];
+    }
+    for (const auto count : counts) {
+        EXPECT_NEAR(count, 20000, 600);
+    }
+}
+
+TEST(RandomProviderTest, EveryProviderShufflesToAPermutation) {
+    std::vector<std::unique_ptr<IRandomProvider>> providers;
+    providers.push_back(std::make_unique<StdRandomProvider>(1));
+    providers.push_back(std::make_unique<XoshiroRandomProvider>(1));
+    providers.push_back(std::make_unique<CounterRandomProvider>(1));
+
+    for (auto& provider : providers) {
+        auto cards = kCardDeck;
+        provider->Shuffle(cards);
+
+        EXPECT_EQ(CardSet::FromCards(cards), CardSet::Full());
+        EXPECT_NE(cards, kCardDeck);
+        EXPECT_LT(provider->UniformIndex(10), 10u);
+    }
+}
+
+TEST(RandomProviderTest, SameSeedSameShuffle) {
+    XoshiroRandomProvider a(2024);
+    XoshiroRandomProvider b(2024);
+    auto cards_a = kCardDeck;
+    auto cards_b = kCardDeck;
+    a.Shuffle(cards_a);
+    b.Shuffle(cards_b);
+    EXPECT_EQ(cards_a, cards_b);
+}
+
+TEST(SeedHierarchyTest, EveryLevelChangesTheSeed) {
+    static_assert(DeriveHandSeed(1, 2, 3) == DeriveSeed(DeriveTableSeed(1, 2), 3));
+
+    const auto base = DeriveHandSeed(1, 0, 0);
+    EXPECT_NE(base, DeriveHandSeed(2, 0, 0));
+    EXPECT_NE(base, DeriveHandSeed(1, 1, 0));
+    EXPECT_NE(base, DeriveHandSeed(1, 0, 1));
+    // Table and hand are not interchangeable.
+    EXPECT_NE(DeriveHandSeed(1, 1, 2), DeriveHandSeed(1, 2, 1));
+}
+
+TEST(RandomProviderTest, ReseedRestartsTheStream) {
+    XoshiroRandomProvider rng(5);
+    const auto first = rng.UniformIndex(1'000'000);
+    (void)rng.UniformIndex(1'000'000);
+
+    rng.Reseed(5);
+    EXPECT_EQ(rng.UniformIndex(1'000'000), first);
+}
+
+TEST(RandomProviderTest, RestoreStateResumesTheStream) {
+    std::vector<std::unique_ptr<IRandomProvider>> providers;
+    providers.push_back(std::make_unique<XoshiroRandomProvider>(8));
+    providers.push_back(std::make_unique<CounterRandomProvider>(8));
+
+    for (auto& rng : providers) {
+        (void)rng->UniformIndex(1'000'000);
+        const auto state = rng->SaveState();
+        ASSERT_TRUE(state.has_value());
+        const auto next = rng->UniformIndex(1'000'000);
+
+        rng->RestoreState(*state);
+        EXPECT_EQ(rng->UniformIndex(1'000'000), next);
+    }
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include "table/SeatMask.hpp"
+
+#include <vector>
+#include <algorithm>
+
+TEST(SeatMaskTest, InsertEraseAndCount) {
+    SeatMask mask;
+    EXPECT_TRUE(mask.Empty());
+
+    mask.Insert(0);
+    mask.Insert(4);
+    mask.Insert(9);
+    EXPECT_EQ(mask.Count(), 3u);
+    EXPECT_TRUE(mask.Contains(4));
+    EXPECT_FALSE(mask.Contains(5));
+
+    mask.Erase(4);
+    EXPECT_FALSE(mask.Contains(4));
+    mask.Set(4, true);
+    EXPECT_TRUE(mask.Contains(4));
+}
+
+TEST(SeatMaskTest, FirstAndLast) {
+    EXPECT_FALSE(SeatMask{}.First());
+    EXPECT_FALSE(SeatMask{}.Last());
+
+    const SeatMask mask{3, 7, 9};
+    EXPECT_EQ(mask.First(), 3u);
+    EXPECT_EQ(mask.Last(), 9u);
+}
+
+TEST(SeatMaskTest, NextAfterWrapsAndReturnsSelfLast) {
+    const SeatMask mask{0, 4, 8};
+    EXPECT_EQ(mask.NextAfter(0), 4u);
+    EXPECT_EQ(mask.NextAfter(4), 8u);
+    EXPECT_EQ(mask.NextAfter(8), 0u);
+    EXPECT_EQ(mask.NextAfter(5), 8u);
+    EXPECT_EQ(mask.NextAfter(15), 0u);
+
+    const SeatMask single{6};
+    EXPECT_EQ(single.NextAfter(6), 6u);
+    EXPECT_FALSE(SeatMask{}.NextAfter(3));
+}
+
+TEST(SeatMaskTest, IteratesInAscendingOrder) {
+    const SeatMask mask{9, 1, 5};
+    const std::vector<std::size_t> seats(mask.begin(), mask.end());
+    EXPECT_EQ(seats, (std::vector<std::size_t>{1, 5, 9}));
+}
+
+TEST(SeatMaskTest, SetOperations) {
+    const SeatMask a{1, 2, 3};
+    const SeatMask b{3, 4};
+    EXPECT_EQ(a | b, (SeatMask{1, 2, 3, 4}));
+    EXPECT_EQ(a & b, SeatMask{3});
+    EXPECT_EQ(a - b, (SeatMask{1, 2}));
+    EXPECT_EQ(SeatMask::FirstN(3), (SeatMask{0, 1, 2}));
+}
+
+TEST(SeatMaskTest, WorksAsSeatIndexRange) {
+    const SeatMask mask{0, 4, 7};
+    EXPECT_EQ(mask.size(), 3u);
+    EXPECT_FALSE(mask.empty());
+    EXPECT_TRUE(SeatMask{}.empty());
+    EXPECT_TRUE(std::ranges::any_of(mask, [](const auto seat) { return seat == 4; }));
+    EXPECT_EQ(std::count_if(mask.cbegin(), mask.cend(), [](const auto seat) { return seat > 3; }), 2);
+}
@@ -2,16 +2,18 @@
 #include "table/Table.hpp"
 #include "core/Card.hpp"
 
+#include <array>
+
 TEST(TableTest, InitializationAndBlinds) {
-    Table table(1.5, 3.0);
-    EXPECT_DOUBLE_EQ(table.GetBlindSmall(), 1.5);
-    EXPECT_DOUBLE_EQ(table.GetBlindBig(), 3.0);
-    EXPECT_DOUBLE_EQ(table.GetPot(), 0.0);
+    Table table(15, 30);
+    EXPECT_EQ(table.GetBlindSmall(), 15);
+    EXPECT_EQ(table.GetBlindBig(), 30);
+    EXPECT_EQ(table.GetPot(), 0);
 
-    table.SetBlindSmall(2.0);
-    table.SetBlindBig(4.0);
-    EXPECT_DOUBLE_EQ(table.GetBlindSmall(), 2.0);
-    EXPECT_DOUBLE_EQ(table.GetBlindBig(), 4.0);
+    table.SetBlindSmall(2);
+    table.SetBlindBig(4);
+    EXPECT_EQ(table.GetBlindSmall(), 2);
+    EXPECT_EQ(table.GetBlindBig(), 4);
 }
 
 TEST(TableTest, PotIncreaseAndCollect) {
@@ -32,7 +34,7 @@ TEST(TableTest, PotIncreaseAndCollect) {
 }
 
 TEST(TableTest, AddAndGetCommunityCards) {
-    Table table(1.0, 2.0);
+    Table table(1, 2);
     Card c1{ECardSuit::HEARTS, ECardRank::ACE};
     Card c2{ECardSuit::SPADES, ECardRank::KING};
 
@@ -45,3 +47,74 @@ TEST(TableTest, AddAndGetCommunityCards) {
     EXPECT_EQ(comm[0], c1);
     EXPECT_EQ(comm[1], c2);
 }
+
+TEST(TableTest, ClearCommunityCards) {
+    Table table(1, 2);
+    table.AddCommunityCard({ECardSuit::HEARTS, ECardRank::ACE});
+    table.AddCommunityCard({ECardSuit::SPADES, ECardRank::KING});
+
+    table.ClearCommunityCards();
+    EXPECT_TRUE(table.GetCommunityCards().empty());
+}
+
+TEST(TableTest, SaveAndRestoreStateRoundTripsPotsAndBoard) {
+    Table table(1, 2);
+    table.AddCommunityCard({ECardSuit::HEARTS, ECardRank::ACE});
+    table.ContributeToPot(0, 10);
+    table.ContributeToPot(3, 10);
+    (void)table.AddPot(0);
+    table.ContributeToPot(3, 5);
+
+    const auto state = table.SaveState();
+    ASSERT_EQ(state.pots.size(), 2);
+    EXPECT_EQ(state.pots[0].players, (1u << 0) | (1u << 3));
+    EXPECT_EQ(state.pots[1].players, 1u << 3);
+
+    Table other(5, 10);
+    other.RestoreState(state);
+    EXPECT_EQ(other.GetBlindBig(), 2);
+    EXPECT_EQ(other.GetCommunityCards(), table.GetCommunityCards());
+    EXPECT_EQ(other.GetCommunityCardSet(), table.GetCommunityCardSet());
+    ASSERT_EQ(other.GetPots().size(), 2);
+    EXPECT_EQ(other.GetPots()[0].amount, 20);
+    EXPECT_EQ(other.GetPots()[0].players, table.GetPots()[0].players);
+    EXPECT_EQ(other.GetPots()[1].players, table.GetPots()[1].players);
+
+    // The current pot index comes back too: new chips land in the side pot.
+    other.ContributeToPot(3, 1);
+    EXPECT_EQ(other.GetPots()[1].amount, 6);
+}
+
+TEST(TableTest, BuildPotsSplitsMultiWayAllIn) {
+    Table table(1, 2);
+    const std::array<Coins_t, 4> contributions {150, 120, 100, 0};
+    table.BuildPots(contributions, SeatMask{0, 1, 2});
+
+    const auto& pots = table.GetPots();
+    ASSERT_EQ(pots.size(), 3);
+    EXPECT_EQ(pots[0].amount, 300);
+    EXPECT_EQ(pots[0].players, (SeatMask{0, 1, 2}));
+    EXPECT_EQ(pots[1].amount, 40);
+    EXPECT_EQ(pots[1].players, (SeatMask{0, 1}));
+    // Uncalled part of seat 0's bet: only seat 0 can win it back.
+    EXPECT_EQ(pots[2].amount, 30);
+    EXPECT_EQ(pots[2].players, (SeatMask{0}));
+}
+
+TEST(TableTest, BuildPotsKeepsFoldedChipsAsDeadMoney) {
+    Table table(1, 2);
+    // Seat 1 folded after putting in 30; seat 2 is all-in for 50.
+    const std::array<Coins_t, 3> contributions {80, 30, 50};
+    table.BuildPots(contributions, SeatMask{0, 2});
+
+    const auto& pots = table.GetPots();
+    ASSERT_EQ(pots.size(), 2);
+    EXPECT_EQ(pots[0].amount, 50 + 30 + 50);
+    EXPECT_EQ(pots[0].players, (SeatMask{0, 2}));
+    EXPECT_EQ(pots[1].amount, 30);
+    EXPECT_EQ(pots[1].players, (SeatMask{0}));
+
+    // New chips go to the last pot.
+    table.ContributeToPot(0, 5);
+    EXPECT_EQ(pots[1].amount, 35);
+}
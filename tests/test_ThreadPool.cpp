@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include "utils/ThreadPool.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(ThreadPoolTest, RunsEverySubmittedTask) {
+    ThreadPool pool(4);
+    std::atomic<int> counter{0};
+
+    for (int i = 0; i < 1000; ++i) {
+        pool.Submit([&counter](std::size_t) { counter.fetch_add(1); });
+    }
+    pool.Wait();
+
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(ThreadPoolTest, WorkerIndexIsInRange) {
+    ThreadPool pool(3);
+    std::atomic<bool> out_of_range{false};
+
+    for (int i = 0; i < 300; ++i) {
+        pool.Submit([&](std::size_t worker_index) {
+            if (worker_index >= pool.GetThreadCount()) out_of_range = true;
+        });
+    }
+    pool.Wait();
+
+    EXPECT_FALSE(out_of_range.load());
+}
+
+TEST(ThreadPoolTest, TasksCanSubmitMoreTasks) {
+    ThreadPool pool(4);
+    std::atomic<int> leaves{0};
+
+    for (int i = 0; i < 16; ++i) {
+        pool.Submit([&](std::size_t) {
+            for (int j = 0; j < 16; ++j) {
+                pool.Submit([&leaves](std::size_t) { leaves.fetch_add(1); });
+            }
+        });
+    }
+    pool.Wait();
+
+    EXPECT_EQ(leaves.load(), 16 * 16);
+}
+
+TEST(ThreadPoolTest, WaitRethrowsTaskErrorAndPoolStaysUsable) {
+    ThreadPool pool(2);
+    pool.Submit([](std::size_t) { throw std::runtime_error("boom"); });
+    EXPECT_THROW(pool.Wait(), std::runtime_error);
+
+    std::atomic<int> counter{0};
+    pool.Submit([&counter](std::size_t) { counter.fetch_add(1); });
+    EXPECT_NO_THROW(pool.Wait());
+    EXPECT_EQ(counter.load(), 1);
+}
+
+TEST(ThreadPoolTest, ZeroThreadsFallsBackToOne) {
+    ThreadPool pool(0);
+    EXPECT_EQ(pool.GetThreadCount(), 1u);
+}
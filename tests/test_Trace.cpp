@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include "sim/HandSimulator.hpp"
+
+#include "utils/AllocationCounter.hpp"
+#include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+class TraceTest : public ::testing::Test {
+protected:
+    void SetUp() override { Tracer::Clear(); }
+    void TearDown() override {
+        Tracer::SetEnabled(false);
+        Tracer::Clear();
+    }
+
+    static std::string Dump() {
+        std::ostringstream out;
+        Tracer::WriteChromeJson(out);
+        return out.str();
+    }
+};
+
+} // namespace
+
+TEST_F(TraceTest, RecordsSpansOnlyWhileEnabled) {
+    { TraceSpan span("disabled"); }
+
+    Tracer::SetEnabled(true);
+    { TraceSpan span("enabled"); }
+    Tracer::SetEnabled(false);
+
+    const auto json = Dump();
+    EXPECT_EQ(json.find("\"disabled\""), std::string::npos);
+    EXPECT_NE(json.find(R"({"name":"enabled","ph":"X","pid":1,"tid":)"), std::string::npos) << json;
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+}
+
+TEST_F(TraceTest, InnerSpanClosesFirstAndNestsInsideOuter) {
+    Tracer::SetEnabled(true);
+    {
+        TraceSpan outer("outer");
+        TraceSpan inner("inner");
+    }
+
+    const auto& buffer = Tracer::ThisThreadBuffer();
+    ASSERT_EQ(buffer.GetSize(), 2u);
+    const auto& inner = buffer[0];
+    const auto& outer = buffer[1];
+    EXPECT_STREQ(inner.name, "inner");
+    EXPECT_STREQ(outer.name, "outer");
+    EXPECT_GE(inner.start_ticks, outer.start_ticks);
+    EXPECT_LE(inner.start_ticks + inner.duration_ticks, outer.start_ticks + outer.duration_ticks);
+}
+
+TEST_F(TraceTest, EachThreadWritesItsOwnBuffer) {
+    Tracer::SetEnabled(true);
+    { TraceSpan span("main"); }
+    std::thread worker([] { TraceSpan span("worker"); });
+    worker.join();
+
+    const auto& main_buffer = Tracer::ThisThreadBuffer();
+    ASSERT_EQ(main_buffer.GetSize(), 1u);
+    EXPECT_STREQ(main_buffer[0].name, "main");
+    EXPECT_NE(Dump().find("\"worker\""), std::string::npos);
+}
+
+TEST_F(TraceTest, RegisteredThreadRecordsWithoutAllocating) {
+    if (!AllocationCounter::IsInstalled()) GTEST_SKIP() << "Allocation hooks not linked";
+
+    Tracer::SetEnabled(true);
+    AllocationCount allocated;
+    std::thread worker([&allocated] {
+        Tracer::RegisterThisThread();
+        const AllocationScope scope;
+        { TraceSpan span("worker"); }
+        allocated = scope.Elapsed();
+    });
+    worker.join();
+
+    EXPECT_EQ(allocated, AllocationCount{});
+    EXPECT_NE(Dump().find("\"worker\""), std::string::npos); // Kept after the thread exited.
+}
+
+TEST_F(TraceTest, EventsPastCapacityAreCountedAsDropped) {
+    Tracer::SetEnabled(true);
+    for (std::size_t i = 0; i < TraceBuffer::kCapacity + 3; ++i) {
+        TraceSpan span("span");
+    }
+
+    EXPECT_EQ(Tracer::GetDropped(), 3u);
+    EXPECT_NE(Dump().find("\"dropped 3 events\""), std::string::npos);
+}
+
+TEST_F(TraceTest, GameLogicTransitionsAreTraced) {
+    if (!Tracer::kCompiledIn) GTEST_SKIP() << "Built without POKER_ENABLE_TRACING";
+
+    const ScopedLogLevel quiet(LogLevel::WARNING);
+    HandSimulator simulator({.players = 4, .seed = 3, .agent = EAgentKind::CALLING});
+    Tracer::SetEnabled(true);
+    SimulationStats stats;
+    simulator.PlayHand(stats);
+    Tracer::SetEnabled(false);
+
+    const auto json = Dump();
+    for (const auto* name : {"StartHand", "ProcessPlayerAction", "AdvanceState", "DealFlop",
+                             "DealTurn", "DealRiver", "HandleShowdown", "ComputePlayersRank", "FinishHand"}) {
+        EXPECT_NE(json.find(std::string("\"GameLogic::") + name + "\""), std::string::npos) << name;
+    }
+}
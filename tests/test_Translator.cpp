@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include "Config.hpp"
+
+#include "core/Card.hpp"
+
+#include "utils/Translator.hpp"
+
+#include <vector>
+
+TEST(TranslatorTest, IdMatchesPhevaluatorStringParsing) {
+    for (const auto& card : kCardDeck) {
+        const phevaluator::Card expected(Translator::FromCustomCardToPhevaluatorCard(card));
+        EXPECT_EQ(Translator::FromCustomCardToPhevaluatorId(card), static_cast<int>(expected))
+            << card.ToString();
+    }
+}
+
+TEST(TranslatorTest, RankMatchesStringEvaluation) {
+    const PlayerSession::Hand_t hand {{
+        {ECardSuit::HEARTS, ECardRank::ACE},
+        {ECardSuit::SPADES, ECardRank::KING}
+    }};
+    const std::vector<Card> community_cards {
+        {ECardSuit::HEARTS, ECardRank::KING},
+        {ECardSuit::CLUBS, ECardRank::TWO},
+        {ECardSuit::DIAMONDS, ECardRank::SEVEN},
+        {ECardSuit::HEARTS, ECardRank::TEN},
+        {ECardSuit::SPADES, ECardRank::ACE}
+    };
+
+    const auto expected = phevaluator::EvaluateCards(
+        Translator::FromCustomCardToPhevaluatorCard(hand[0]).c_str(),
+        Translator::FromCustomCardToPhevaluatorCard(hand[1]).c_str(),
+        Translator::FromCustomCardToPhevaluatorCard(community_cards[0]).c_str(),
+        Translator::FromCustomCardToPhevaluatorCard(community_cards[1]).c_str(),
+        Translator::FromCustomCardToPhevaluatorCard(community_cards[2]).c_str(),
+        Translator::FromCustomCardToPhevaluatorCard(community_cards[3]).c_str(),
+        Translator::FromCustomCardToPhevaluatorCard(community_cards[4]).c_str());
+
+    EXPECT_EQ(Translator::RankFromPlayerTableCards(hand, community_cards).value(), expected.value());
+}
@@ -0,0 +1,208 @@
+// Plays hands headlessly and reports throughput.
+//
+//   poker_sim [--hands N] [--players N] [--agent random|calling|scripted]
+//             [--script fold,call,raise,...] [--seed N] [--stack N]
+//             [--tables N] [--threads N] [--replay TABLE:HAND]
+//             [--trace FILE]
+//
+// With more than one table, --hands is per table and tables are spread over
+// the worker threads. --replay re-deals a single hand of a run (same seed and
+// agent options) with debug logging on and prints how it ended; the per-bet
+// log lines need a build with POKER_LOG_MIN_LEVEL=DEBUG (the Debug default).
+// Heap allocations per hand are reported by the state each GameLogic call
+// left the hand in; a steady-state hand should make none.
+// --trace writes the GameLogic spans as Chrome trace JSON (needs a build
+// with POKER_ENABLE_TRACING).
+
+#include "sim/HandSimulator.hpp"
+#include "sim/MultiTableRunner.hpp"
+
+#include "utils/AllocationCounter.hpp"
+#include "utils/EnumStringConverter.hpp"
+#include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace {
+
+EPlayerAction ParseAction(std::string_view name) {
+    if (name == "fold")   return EPlayerAction::FOLD;
+    if (name == "check")  return EPlayerAction::CHECK;
+    if (name == "call")   return EPlayerAction::CALL;
+    if (name == "bet")    return EPlayerAction::BET;
+    if (name == "raise")  return EPlayerAction::RAISE;
+    if (name == "allin")  return EPlayerAction::ALL_IN;
+    throw std::invalid_argument("Unknown action: " + std::string(name));
+}
+
+EAgentKind ParseAgent(std::string_view name) {
+    if (name == "random")   return EAgentKind::RANDOM;
+    if (name == "calling")  return EAgentKind::CALLING;
+    if (name == "scripted") return EAgentKind::SCRIPTED;
+    throw std::invalid_argument("Unknown agent: " + std::string(name));
+}
+
+std::vector<EPlayerAction> ParseScript(const std::string& list) {
+    std::vector<EPlayerAction> script;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        script.push_back(ParseAction(item));
+    }
+    return script;
+}
+
+Coins_t ParseStack(const std::string& value) {
+    const Coins_t stack = std::stoll(value);
+    if (stack <= 0) throw std::invalid_argument("--stack must be positive");
+    return stack;
+}
+
+struct ReplayTarget {
+    std::uint64_t table;
+    std::uint64_t hand;
+};
+
+ReplayTarget ParseReplay(const std::string& value) {
+    const auto colon = value.find(':');
+    if (colon == std::string::npos) throw std::invalid_argument("--replay expects TABLE:HAND");
+    return {std::stoull(value.substr(0, colon)), std::stoull(value.substr(colon + 1))};
+}
+
+int Replay(SimulationConfig config, ReplayTarget target) {
+    config.table_id = target.table;
+    HandSimulator simulator(config);
+
+    if (!Logger::IsCompiledIn(LogLevel::DEBUG)) {
+        std::cerr << "note: debug logging is compiled out, rebuild with POKER_LOG_MIN_LEVEL=DEBUG"
+                  << " to see each bet\n";
+    }
+
+    SimulationStats stats;
+    simulator.ReplayHand(target.hand, stats);
+    Logger::Flush(); // The hand's log lines go before the summary.
+
+    std::cout << "table " << target.table << ", hand " << target.hand
+              << ": " << stats.actions << " actions\nboard:";
+    for (const auto& card : simulator.GetTable().GetCommunityCards()) {
+        std::cout << " " << card.ToString();
+    }
+    std::cout << "\n";
+
+    const auto& player_list = simulator.GetPlayerList();
+    for (const auto seat : player_list.GetOccupiedSeatIndices()) {
+        const auto& session = player_list.GetSession(seat);
+        std::cout << "seat " << seat << ": stack " << player_list.GetPlayer(seat).GetStack()
+                  << (session.IsFold() ? " (folded)" : "")
+                  << (session.IsAllIn() ? " (all-in)" : "") << "\n";
+    }
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    SimulationConfig config;
+    std::uint64_t hands = 100'000;
+    std::size_t tables = 1;
+    std::size_t threads = std::thread::hardware_concurrency();
+    std::optional<ReplayTarget> replay;
+    std::string trace_path;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            if (i + 1 >= argc) throw std::invalid_argument("Missing value for " + std::string(arg));
+            const std::string value = argv[++i];
+
+            if (arg == "--hands")        hands = std::stoull(value);
+            else if (arg == "--players") config.players = std::stoul(value);
+            else if (arg == "--agent")   config.agent = ParseAgent(value);
+            else if (arg == "--script")  config.script = ParseScript(value);
+            else if (arg == "--seed")    config.seed = std::stoull(value);
+            else if (arg == "--stack")   config.starting_stack = ParseStack(value);
+            else if (arg == "--tables")  tables = std::stoul(value);
+            else if (arg == "--threads") threads = std::stoul(value);
+            else if (arg == "--replay")  replay = ParseReplay(value);
+            else if (arg == "--trace")   trace_path = value;
+            else throw std::invalid_argument("Unknown option: " + std::string(arg));
+        }
+        // Checked here so the run below cannot fail on a bad config, even
+        // inside a worker thread.
+        HandSimulator::Validate(config);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n"
+                  << "Usage: " << argv[0] << " [--hands N] [--players N] [--agent random|calling|scripted]"
+                  << " [--script fold,call,raise,...] [--seed N] [--stack N]"
+                  << " [--tables N] [--threads N] [--replay TABLE:HAND] [--trace FILE]\n";
+        return EXIT_FAILURE;
+    }
+
+    if (replay) return Replay(config, *replay);
+
+    // Per-action debug logging would dominate the run time.
+    Logger::SetMinLevel(LogLevel::WARNING);
+
+    if (!trace_path.empty()) {
+        if (!Tracer::kCompiledIn) {
+            std::cerr << "warning: built without POKER_ENABLE_TRACING, the trace will be empty\n";
+        }
+        Tracer::SetEnabled(true);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    SimulationStats stats;
+    if (tables > 1) {
+        MultiTableRunner runner(threads);
+        stats = runner.Run(config, tables, hands);
+    } else {
+        HandSimulator simulator(config);
+        stats = simulator.Run(hands);
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "hands:     " << stats.hands << "\n"
+              << "actions:   " << stats.actions << "\n"
+              << "showdowns: " << stats.showdowns << "\n"
+              << "elapsed:   " << elapsed.count() << " s\n"
+              << "hands/sec: " << static_cast<double>(stats.hands) / elapsed.count() << "\n";
+
+    if (!trace_path.empty()) {
+        Tracer::SetEnabled(false);
+        std::ofstream trace_file(trace_path);
+        Tracer::WriteChromeJson(trace_file);
+        std::cout << "trace:     " << trace_path << "\n";
+        if (const auto dropped = Tracer::GetDropped(); dropped > 0) {
+            std::cerr << "warning: " << dropped << " trace events dropped (buffers full),"
+                      << " trace fewer hands to keep them all\n";
+        }
+    }
+
+    if (AllocationCounter::IsInstalled() && stats.hands > 0) {
+        const auto per_hand = [&](std::uint64_t value) {
+            return static_cast<double>(value) / static_cast<double>(stats.hands);
+        };
+        AllocationCount total;
+        for (const auto& count : stats.allocations) total += count;
+        std::cout << "allocations per hand: " << per_hand(total.allocations)
+                  << " (" << per_hand(total.bytes) << " bytes)\n";
+        for (std::size_t i = 0; i < stats.allocations.size(); ++i) {
+            const auto& count = stats.allocations[i];
+            if (count.allocations == 0) continue;
+            std::cout << "  " << EnumString::ToString(static_cast<ELogicState>(i)) << ": "
+                      << per_hand(count.allocations) << " (" << per_hand(count.bytes) << " bytes)\n";
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+// Generates the heads-up preflop equity table loaded by PreflopEquityTable.
+//
+//   poker_preflop_table <output_file> [trials_per_matchup] [threads] [seed]
+
+#include "equity/EquityCalculator.hpp"
+#include "equity/PreflopEquityTable.hpp"
+
+#include "utils/ThreadPool.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kClasses = PreflopEquityTable::kHandClasses;
+
+bool SharesCard(const PlayerSession::Hand_t& a, const PlayerSession::Hand_t& b) {
+    return (CardSet::FromCards(a).Intersects(CardSet::FromCards(b)));
+}
+
+// Class equity is the average over every pair of concrete combos that can be
+// dealt together. Trials are split evenly between those pairs.
+double ComputeMatchup(std::size_t hero, std::size_t villain, std::uint64_t trials, std::uint64_t seed) {
+    if (hero == villain) return 0.5;
+
+    const auto hero_combos = PreflopEquityTable::GetClassCombos(hero);
+    const auto villain_combos = PreflopEquityTable::GetClassCombos(villain);
+
+    std::size_t pairs = 0;
+    for (const auto& h : hero_combos)
+        for (const auto& v : villain_combos)
+            pairs += !SharesCard(h, v);
+
+    const auto trials_per_pair = std::max<std::uint64_t>(1, trials / pairs);
+    double equity_sum = 0.0;
+    std::uint64_t pair_index = 0;
+    for (const auto& h : hero_combos) {
+        for (const auto& v : villain_combos) {
+            if (SharesCard(h, v)) continue;
+
+            EquityInput input;
+            input.players.push_back({0, h});
+            input.players.push_back({1, v});
+            const auto pair_seed = seed + (hero * kClasses + villain) * 0x9E3779B97F4A7C15ULL + pair_index++;
+            equity_sum += EquityCalculator::RunMonteCarloInline(input, trials_per_pair, pair_seed).GetEquity(0);
+        }
+    }
+    return equity_sum / static_cast<double>(pairs);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <output_file> [trials_per_matchup] [threads] [seed]\n";
+        return EXIT_FAILURE;
+    }
+
+    const std::string output = argv[1];
+    const std::uint64_t trials = (argc > 2) ? std::stoull(argv[2]) : 200'000;
+    const std::size_t threads = (argc > 3) ? std::stoul(argv[3]) : std::thread::hardware_concurrency();
+    const std::uint64_t seed = (argc > 4) ? std::stoull(argv[4]) : 20240801;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // Rows are independent; each task fills row i from the diagonal on and
+    // mirrors it into column i.
+    std::vector<double> equities(kClasses * kClasses, 0.0);
+    ThreadPool pool(threads);
+    for (std::size_t hero = 0; hero < kClasses; ++hero) {
+        pool.Submit([&equities, hero, trials, seed](std::size_t) {
+            for (std::size_t villain = hero; villain < kClasses; ++villain) {
+                const auto equity = ComputeMatchup(hero, villain, trials, seed);
+                equities[hero * kClasses + villain] = equity;
+                equities[villain * kClasses + hero] = 1.0 - equity;
+            }
+        });
+    }
+    pool.Wait();
+
+    PreflopEquityTable::Write(output, equities);
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << "Wrote " << kClasses * kClasses << " matchups to " << output
+              << " in " << elapsed.count() << "s using " << pool.GetThreadCount() << " threads\n";
+    return EXIT_SUCCESS;
+}